@@ -1,49 +1,71 @@
 #include "simple.h"
-#include <iostream>
 
 using Simple::Buffer;
 using Simple::Color;
 using Simple::Palette16;
 using Simple::Palette256;
 
-int main() {
+int main(int argc, char* argv[]) {
+	// --inline: hanya menguasai baris form dibawah cursor, scrollback terminal tetap utuh
+	bool inlineMode = argc > 1 && std::string(argv[1]) == "--inline";
+
 	HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
 	HANDLE hIn = GetStdHandle(STD_INPUT_HANDLE);
 
 	// Set console agar support unicode
 	SetConsoleOutputCP(CP_UTF8);
 
+	// Aktifkan event perubahan ukuran console
+	DWORD inputMode;
+	GetConsoleMode(hIn, &inputMode);
+	SetConsoleMode(hIn, inputMode | ENABLE_WINDOW_INPUT);
+
 	// Ambil ukuran console
 	CONSOLE_SCREEN_BUFFER_INFO csbi;
 	GetConsoleScreenBufferInfo(hOut, &csbi);
+	COORD size = csbi.dwSize;
 
 	Buffer mainBuffer = Buffer(csbi.dwSize.Y, csbi.dwSize.X);
 	bool update = true;
 	bool running = true;
 
-	auto iNamaDepan = Input("Nama Depan");
-	iNamaDepan->Width = 24;
-	auto iNamaBelakang = Input("Nama Belakang");
-	iNamaBelakang->Width = 24;
-	auto rLakiLaki = RadioBox("Laki Laki");
-	auto rPerempuan = RadioBox("Perempuan");
-	auto sgJenisKelamin = SelectableGroup(rLakiLaki, rPerempuan);
-	auto iAlamat = Input();
-	iAlamat->Width = 49;
-	iAlamat->Height = 3;
-	auto rIslam = RadioBox("Islam");
-	auto rKristen1 = RadioBox("Kristen Protestan");
-	auto rKristen2 = RadioBox("Kristen Katolik");
-	auto rHindu = RadioBox("Hindu");
-	auto rBuddha = RadioBox("Buddha");
-	auto rKonghuchu = RadioBox("Konghuchu");
-	auto sgAgama = SelectableGroup(rIslam, rKristen1, rKristen2, rHindu, rBuddha, rKonghuchu);
-	auto iNoHP = Input();
-	iNoHP->Width = 49;
-	iNoHP->Limit = 14;
-	iNoHP->Pattern = isdigit;
-	auto dJurusan = Dropdown("Silakan Pilih",
-		{
+	// Wheel dibuat sebelum node agar timer milik widget masih valid saat node dihancurkan
+	Simple::TimerWheel timers;
+	Simple::TimerWheel::Current() = &timers;
+	Simple::Presenter presenter;
+
+	// Node form dan arenanya dimiliki satu ArenaTree. Arena hanya aktif selama form dibangun, sehingga node yang
+	// dibuat kemudian memakai heap biasa, dan arena lama dilepas sekaligus setiap kali form dibangun ulang
+	class Form final {
+	public:
+		std::shared_ptr<Simple::Base::Renderable> Layout;
+		std::shared_ptr<Simple::Base::Focusable> Focus;
+		std::vector<std::shared_ptr<Simple::SelectableGroup>> Groups;
+	};
+	bool rebuild = false;
+	auto build = [&]() -> Form {
+		auto iNamaDepan = Input("Nama Depan");
+		iNamaDepan->Width = 24;
+		auto iNamaBelakang = Input("Nama Belakang");
+		iNamaBelakang->Width = 24;
+		auto rLakiLaki = RadioBox("Laki Laki");
+		auto rPerempuan = RadioBox("Perempuan");
+		auto sgJenisKelamin = SelectableGroup(rLakiLaki, rPerempuan);
+		auto iAlamat = TextArea();
+		iAlamat->Width = 49;
+		iAlamat->Height = 3;
+		auto rIslam = RadioBox("Islam");
+		auto rKristen1 = RadioBox("Kristen Protestan");
+		auto rKristen2 = RadioBox("Kristen Katolik");
+		auto rHindu = RadioBox("Hindu");
+		auto rBuddha = RadioBox("Buddha");
+		auto rKonghuchu = RadioBox("Konghuchu");
+		auto sgAgama = SelectableGroup(rIslam, rKristen1, rKristen2, rHindu, rBuddha, rKonghuchu);
+		auto iNoHP = Input();
+		iNoHP->Width = 49;
+		iNoHP->Limit = 14;
+		iNoHP->Pattern = isdigit;
+		std::vector<std::string> jurusan = {
 			"Teknologi Pendidikan",
 			"Administrasi Pendidikan",
 			"Manajemen Pendidikan",
@@ -97,73 +119,154 @@ int main() {
 			"Tata Rias",
 			"Tata Busana",
 			"Tata Boga"
-		}
-	);
-	dJurusan->Width = 49;
-	auto cbTnC = CheckBox("Saya telah membaca peraturan.");
-	auto cbAgree = CheckBox("Saya menyetujui peraturan.");
-	auto bDaftar = Button("Daftar");
-	auto bExit = Button("Exit", [&running]() { running = false; });
-
-	auto vLayout = //HLayout(
-		VLayout(
-			Text("PENDAFTARAN MAHASISWA BARU") | CenterX | BorderStyle(DoubleLine) | FlexX,
-			Text("Nama Lengkap"),
-			HLayout(iNamaDepan, Text(" "), iNamaBelakang),
-			Text("Jenis Kelamin"),
-			HLayout(rLakiLaki, Text(" "), rPerempuan),
-			Text("Alamat Rumah"),
+		};
+		// Saran dinilai di thread lain, hasilnya membangunkan loop lewat TimerWheel::Wake
+		auto iCariJurusan = Input("Cari jurusan");
+		iCariJurusan->Width = 49;
+		iCariJurusan->Complete(Completion(jurusan, 5));
+		auto dJurusan = Dropdown("Silakan Pilih", jurusan);
+		dJurusan->Width = 49;
+		auto cbTnC = CheckBox("Saya telah membaca peraturan.");
+		auto cbAgree = CheckBox("Saya menyetujui peraturan.");
+		auto bDaftar = Button("Daftar", [&]() {
+			// Pada mode inline konfirmasi masuk ke scrollback diatas form
+			if (inlineMode) {
+				presenter.Print("Pendaftaran terkirim.\n");
+			}
+			// Form dikosongkan dengan membangun ulang tree setelah event selesai diproses, tombol ini ikut dihancurkan
+			rebuild = true;
+		});
+		auto bExit = Button("Exit", [&running]() { running = false; });
+
+		// Kolom nama dan pilihan agama cukup satu node Grid, tanpa HLayout bersarang dan Text spasi
+		auto gNama = Grid({ Simple::Track::Auto(), Simple::Track::Auto() });
+		gNama->GapX = 1;
+		gNama->Add(iNamaDepan, 0, 0).Add(iNamaBelakang, 0, 1);
+		auto gAgama = Grid({ Simple::Track::Auto(), Simple::Track::Auto(), Simple::Track::Auto() });
+		gAgama->GapX = 1;
+		gAgama
+			->Add(rIslam, 0, 0).Add(rKristen1, 0, 1).Add(rKristen2, 0, 2)
+			.Add(rHindu, 1, 0).Add(rBuddha, 1, 1).Add(rKonghuchu, 1, 2);
+
+		Form form;
+		form.Groups = { sgJenisKelamin, sgAgama };
+		form.Layout = //HLayout(
+			VLayout(
+				Text("PENDAFTARAN MAHASISWA BARU") | CenterX | BorderStyle(DoubleLine) | Cache | FlexX,
+				Text("Nama Lengkap"),
+				gNama,
+				Text("Jenis Kelamin"),
+				HLayout(rLakiLaki, Text(" "), rPerempuan),
+				Text("Alamat Rumah"),
+				iAlamat,
+				Text("Agama"),
+				gAgama,
+				Text("Nomor Handphone"),
+				iNoHP,
+				Text("Jurusan yang dituju"),
+				iCariJurusan,
+				dJurusan,
+				cbTnC,
+				cbAgree,
+				bDaftar,
+				bExit
+			) | BorderStyle(Rounded) | CenterX;
+		//);
+
+		form.Focus = VContainer(
+			HContainer(iNamaDepan, iNamaBelakang),
+			HContainer(rLakiLaki, rPerempuan),
 			iAlamat,
-			Text("Agama"),
-			HLayout(rIslam, Text(" "), rKristen1, Text(" "), rKristen2),
-			HLayout(rHindu, Text(" "), rBuddha, Text(" "), rKonghuchu),
-			Text("Nomor Handphone"),
+			HContainer(rIslam, rKristen1, rKristen2),
+			HContainer(rHindu, rBuddha, rKonghuchu),
 			iNoHP,
-			Text("Jurusan yang dituju"),
+			iCariJurusan,
 			dJurusan,
 			cbTnC,
 			cbAgree,
 			bDaftar,
 			bExit
-		) | BorderStyle(Rounded) | CenterX;
-	//);
-
-	auto vContainer = VContainer(
-		HContainer(iNamaDepan, iNamaBelakang),
-		HContainer(rLakiLaki, rPerempuan),
-		iAlamat,
-		HContainer(rIslam, rKristen1, rKristen2),
-		HContainer(rHindu, rBuddha, rKonghuchu),
-		iNoHP,
-		dJurusan,
-		cbTnC,
-		cbAgree,
-		bDaftar,
-		bExit
-	);
-	vContainer->Focused(true);
+		);
+		form.Focus->Focused(true);
+		return form;
+	};
+	Simple::Utility::ArenaTree<Form> tree;
+	tree.Build(build);
 
 	INPUT_RECORD record[128];
 	DWORD eventsRead;
+	// Event wheel diberi sinyal oleh widget yang selesai bekerja di background (TimerWheel::Wake)
+	HANDLE waitHandles[] = { hIn, timers.Event() };
 	while (running) {
-		ReadConsoleInput(hIn, record, 128, &eventsRead);
+		// Tunggu input, wake dari thread lain, deadline timer berikutnya, atau giliran frame berikutnya
+		DWORD timeout = timers.Timeout();
+		if (update) {
+			timeout = std::min(timeout, presenter.Delay());
+		}
+
+		if (WaitForMultipleObjects(2, waitHandles, FALSE, timeout) == WAIT_OBJECT_0) {
+			ReadConsoleInput(hIn, record, 128, &eventsRead);
+
+			for (DWORD i = 0; i < eventsRead; ++i) {
+				if (record[i].EventType == KEY_EVENT && record[i].Event.KeyEvent.bKeyDown) {
+					update = true;
+					tree.Root().Focus->OnKey(record[i].Event.KeyEvent);
+				}
 
-		for (DWORD i = 0; i < eventsRead; ++i) {
-			if (record[i].EventType == KEY_EVENT && record[i].Event.KeyEvent.bKeyDown) {
-				update = true;
-				vContainer->OnKey(record[i].Event.KeyEvent);
+				// Resize beruntun cukup dicatat, layout ulang dilakukan sekali saat frame berikutnya
+				if (record[i].EventType == WINDOW_BUFFER_SIZE_EVENT) {
+					update = true;
+					size = record[i].Event.WindowBufferSizeEvent.dwSize;
+				}
 			}
+		}
+
+		// Tree lama dihancurkan di luar callback node miliknya
+		if (rebuild) {
+			rebuild = false;
+			update = true;
+			tree.Build(build);
+		}
+
+		// Jalankan timer yang sudah jatuh tempo, juga true jika ada widget yang membangunkan loop
+		if (timers.Advance()) {
+			update = true;
+		}
 
-			if (update) {
-				update = false;
+		// Frame hanya digambar saat terminal siap, sehingga yang tampil selalu state terbaru
+		if (update && presenter.Delay() == 0) {
+			update = false;
+			if (mainBuffer.Height() != size.Y || mainBuffer.Width() != size.X) {
+				mainBuffer.Resize(size.Y, size.X);
+			}
+			else {
 				mainBuffer.Clear();
-				vLayout->Init();
-				vLayout->Set({ 0, 0, csbi.dwSize.X, csbi.dwSize.Y });
-				vLayout->Render(mainBuffer);
-				std::cout << "\x1b[H" << mainBuffer.ToString() << std::flush;
 			}
+			const auto& vLayout = tree.Root().Layout;
+			vLayout->Measure();
+			// Region inline setinggi form, ikut berubah saat dropdown dibuka atau ditutup
+			int height = inlineMode ? std::min<int>(vLayout->Height, size.Y) : size.Y;
+			if (inlineMode && presenter.Lines() != height) {
+				presenter.Inline(height);
+			}
+			vLayout->Place({ 0, 0, size.X, height });
+			// Node yang tingginya bergantung pada lebar (Paragraph) baru tahu ukurannya setelah Place
+			if (Simple::Base::Renderable::Relayout()) {
+				Simple::Base::Renderable::Relayout() = false;
+				vLayout->Measure();
+				vLayout->Place({ 0, 0, size.X, height });
+			}
+			vLayout->Render(mainBuffer);
+			presenter.Present(hOut, mainBuffer);
 		}
 	}
 
+	// Hapus region inline agar prompt shell muncul tepat dibawah output sebelumnya
+	if (inlineMode) {
+		const std::string& rest = presenter.Close();
+		DWORD written = 0;
+		WriteFile(hOut, rest.data(), static_cast<DWORD>(rest.size()), &written, nullptr);
+	}
+
 	return 0;
 }
\ No newline at end of file
@@ -2,12 +2,33 @@
 #define _SIMPLE_
 #define NOMINMAX
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <sstream>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 #include <vector>
 #include <windows.h>
 
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <immintrin.h>
+#endif
+
 namespace Simple {
 	enum class Palette16 : int {
 		Black = 30,
@@ -289,6 +310,73 @@ namespace Simple {
 		WhiteSmoke = 255
 	};
 
+	enum class ColorDepth : int {
+		Palette16,
+		Palette256,
+		TrueColor
+	};
+
+	class Capabilities final {
+	public:
+		ColorDepth Depth = ColorDepth::TrueColor;
+		// REP (CSI n b), ulangi karakter terakhir
+		bool Repeat = false;
+		// ECH (CSI n X), hapus n karakter tanpa memindahkan cursor
+		bool Erase = false;
+		// Synchronized output (DEC private mode 2026)
+		bool Synchronized = false;
+
+	public:
+		// Deteksi kemampuan terminal dari environment variable
+		static auto Detect() -> Capabilities {
+			Capabilities result;
+			std::string colorTerm = environment("COLORTERM");
+			std::string term = environment("TERM");
+
+			if (colorTerm == "truecolor" || colorTerm == "24bit" || !environment("WT_SESSION").empty()) {
+				result.Depth = ColorDepth::TrueColor;
+			}
+			else if (term.empty()) {
+				// Console Windows (conhost) sudah mendukung 24-bit sejak Windows 10
+				result.Depth = ColorDepth::TrueColor;
+			}
+			else if (term.find("256color") != std::string::npos || term.find("direct") != std::string::npos) {
+				result.Depth = term.find("direct") != std::string::npos ? ColorDepth::TrueColor : ColorDepth::Palette256;
+			}
+			else {
+				result.Depth = ColorDepth::Palette16;
+			}
+
+			bool xterm = term.find("xterm") != std::string::npos || term.find("tmux") != std::string::npos || term.find("screen") != std::string::npos;
+			result.Repeat = xterm || !environment("WT_SESSION").empty();
+			result.Erase = result.Repeat || term.empty();
+
+			std::string program = environment("TERM_PROGRAM");
+			result.Synchronized =
+				!environment("WT_SESSION").empty() ||
+				term.find("kitty") != std::string::npos ||
+				term.find("foot") != std::string::npos ||
+				term.find("alacritty") != std::string::npos ||
+				term.find("contour") != std::string::npos ||
+				program == "WezTerm" ||
+				program == "iTerm.app";
+
+			return result;
+		}
+		// Kemampuan yang dipakai saat menulis output
+		static auto Current() -> Capabilities& {
+			static Capabilities current = Detect();
+			return current;
+		}
+
+	private:
+		static auto environment(const char* name) -> std::string {
+			char value[256];
+			DWORD size = GetEnvironmentVariableA(name, value, sizeof(value));
+			return size > 0 && size < sizeof(value) ? std::string(value, size) : std::string();
+		}
+	};
+
 	class BorderStyle final {
 	public:
 		class Alignment final {
@@ -306,6 +394,18 @@ namespace Simple {
 		Alignment Bottom;
 	};
 	class Rectangle final {
+	public:
+		auto operator ==(const Rectangle& other) const -> bool {
+			return
+				this->Left == other.Left &&
+				this->Top == other.Top &&
+				this->Right == other.Right &&
+				this->Bottom == other.Bottom;
+		}
+		auto operator !=(const Rectangle& other) const -> bool {
+			return !(*this == other);
+		}
+
 	public:
 		int Left = 0;
 		int Top = 0;
@@ -343,94 +443,93 @@ namespace Simple {
 			this->Blue = std::stoi(hex.substr(5, 2), nullptr, 16);
 		}
 		auto Foreground() -> const std::string {
-			std::string result;
-
-			result += "\x1b[";
-			switch (this->colorType) {
-			case Type::Palette16:
-				result += std::to_string(this->Red);
-				break;
-			case Type::Palette256:
-				result += "38;5;";
-				result += std::to_string(this->Red);
-				break;
-			case Type::RGB:
-				result += "38;2;";
-				result += std::to_string(this->Red) + ";";
-				result += std::to_string(this->Green) + ";";
-				result += std::to_string(this->Blue);
-				break;
-			}
-			result += "m";
+			char sequence[24] = "\x1b[";
+			char* end = this->Parameters(sequence + 2, false);
+			*end++ = 'm';
 
-			return std::move(result);
+			return std::string(sequence, end);
 		}
 		auto Foreground(std::ostringstream& ostr) -> void {
-			ostr << "\x1b[";
-			switch (this->colorType) {
-			case Type::Palette16:
-				ostr << this->Red;
-				break;
-			case Type::Palette256:
-				ostr << "38;5;" << this->Red;
-				break;
-			case Type::RGB:
-				ostr << "38;2;"
-					<< this->Red << ";"
-					<< this->Green << ";"
-					<< this->Blue;
-				break;
-			}
-			ostr << "m";
+			ostr << this->Foreground();
 		}
 		auto Background() -> const std::string {
-			std::string result;
+			char sequence[24] = "\x1b[";
+			char* end = this->Parameters(sequence + 2, true);
+			*end++ = 'm';
+
+			return std::string(sequence, end);
+		}
+		auto Background(std::ostringstream& ostr) -> void {
+			ostr << this->Background();
+		}
+		// Tulis parameter SGR (tanpa CSI dan 'm') ke output, maksimal 19 byte
+		auto Parameters(char* output, bool background) const -> char* {
+			Color color = this->Downsample(Capabilities::Current().Depth);
 
-			result += "\x1b[";
-			switch (this->colorType) {
+			switch (color.colorType) {
 			case Type::Palette16:
-				result += std::to_string(this->Red + 10);
-				break;
+				return std::to_chars(output, output + 3, color.Red + (background ? 10 : 0)).ptr;
 			case Type::Palette256:
-				result += "48;5;";
-				result += std::to_string(this->Red);
-				break;
+				std::memcpy(output, background ? "48;5;" : "38;5;", 5);
+				return std::to_chars(output + 5, output + 8, color.Red).ptr;
 			case Type::RGB:
-				result += "48;2;";
-				result += std::to_string(this->Red) + ";";
-				result += std::to_string(this->Green) + ";";
-				result += std::to_string(this->Blue);
-				break;
+				std::memcpy(output, background ? "48;2;" : "38;2;", 5);
+				output = std::to_chars(output + 5, output + 8, color.Red).ptr;
+				*output++ = ';';
+				output = std::to_chars(output, output + 3, color.Green).ptr;
+				*output++ = ';';
+				return std::to_chars(output, output + 3, color.Blue).ptr;
 			}
-			result += "m";
 
-			return std::move(result);
+			return output;
 		}
-		auto Background(std::ostringstream& ostr) -> void {
-			ostr << "\x1b[";
-			switch (this->colorType) {
-			case Type::Palette16:
-				ostr << this->Red;
-				break;
-			case Type::Palette256:
-				ostr << "48;5;" << this->Red;
-				break;
-			case Type::RGB:
-				ostr << "48;2;"
-					<< this->Red << ";"
-					<< this->Green << ";"
-					<< this->Blue;
-				break;
+		// Warna dalam 26 bit: tipe (2 bit) dan tiga komponen 8 bit
+		auto Pack() const -> uint32_t {
+			return
+				static_cast<uint32_t>(this->colorType) << 24 |
+				static_cast<uint32_t>(this->Red & 0xFF) << 16 |
+				static_cast<uint32_t>(this->Green & 0xFF) << 8 |
+				static_cast<uint32_t>(this->Blue & 0xFF);
+		}
+		auto IsDefault() const -> bool {
+			return this->colorType == Type::Palette16 && this->Red == static_cast<int>(Palette16::Default);
+		}
+		// Turunkan warna ke palette terdekat sesuai kemampuan terminal
+		auto Downsample(ColorDepth depth) const -> Color {
+			if (depth == ColorDepth::TrueColor || this->colorType == Type::Palette16) {
+				return *this;
+			}
+
+			if (this->colorType == Type::RGB) {
+				int index = (this->Red >> 3) << 10 | (this->Green >> 3) << 5 | (this->Blue >> 3);
+				if (depth == ColorDepth::Palette256) {
+					return Palette256(lookup256()[index]);
+				}
+				return Palette16(sgr16(lookup16()[index]));
 			}
-			ostr << "m";
+
+			// Palette256 pada terminal 16 warna
+			if (depth == ColorDepth::Palette16) {
+				if (this->Red < 16) {
+					return Palette16(sgr16(this->Red));
+				}
+
+				int red, green, blue;
+				palette256(this->Red, red, green, blue);
+				return Palette16(sgr16(lookup16()[(red >> 3) << 10 | (green >> 3) << 5 | (blue >> 3)]));
+			}
+
+			return *this;
 		}
-		auto operator ==(const Color& other) -> bool {
+		auto operator ==(const Color& other) const -> bool {
+			// Index palette disimpan di ketiga komponen, sehingga tipe warna ikut dibandingkan
 			return
+				this->colorType == other.colorType &&
 				this->Red == other.Red &&
 				this->Green == other.Green &&
 				this->Blue == other.Blue;
 		}
-		auto operator !=(const Color& other) -> bool {
+		auto operator !=(const Color& other) const -> bool {
 			return !(*this == other);
 		}
 
@@ -446,6 +545,94 @@ namespace Simple {
 			RGB
 		};
 		Type colorType = Type::Palette16;
+
+	private:
+		static auto sgr16(int index) -> int {
+			return index < 8 ? 30 + index : 90 + index - 8;
+		}
+		// Nilai RGB standar xterm untuk index palette 256
+		static auto palette256(int index, int& red, int& green, int& blue) -> void {
+			static const unsigned char system[16][3] = {
+				{ 0, 0, 0 }, { 128, 0, 0 }, { 0, 128, 0 }, { 128, 128, 0 },
+				{ 0, 0, 128 }, { 128, 0, 128 }, { 0, 128, 128 }, { 192, 192, 192 },
+				{ 128, 128, 128 }, { 255, 0, 0 }, { 0, 255, 0 }, { 255, 255, 0 },
+				{ 0, 0, 255 }, { 255, 0, 255 }, { 0, 255, 255 }, { 255, 255, 255 }
+			};
+			static const int levels[6] = { 0, 95, 135, 175, 215, 255 };
+
+			if (index < 16) {
+				red = system[index][0];
+				green = system[index][1];
+				blue = system[index][2];
+			}
+			else if (index < 232) {
+				red = levels[(index - 16) / 36];
+				green = levels[(index - 16) / 6 % 6];
+				blue = levels[(index - 16) % 6];
+			}
+			else {
+				red = green = blue = 8 + (index - 232) * 10;
+			}
+		}
+		static auto distance(int r1, int g1, int b1, int r2, int g2, int b2) -> int {
+			return 2 * (r1 - r2) * (r1 - r2) + 4 * (g1 - g2) * (g1 - g2) + 3 * (b1 - b2) * (b1 - b2);
+		}
+		// Lookup table 32x32x32, dihitung sekali saat pertama dipakai
+		static auto lookup256() -> const unsigned char* {
+			static const std::vector<unsigned char> table = [] {
+				std::vector<unsigned char> result(32 * 32 * 32);
+				auto level = [](int value) {
+					return value < 48 ? 0 : value < 115 ? 1 : (value - 35) / 40;
+				};
+
+				for (int i = 0; i < 32 * 32 * 32; ++i) {
+					int red = (i >> 10) << 3 | 4, green = (i >> 5 & 31) << 3 | 4, blue = (i & 31) << 3 | 4;
+
+					// Kandidat dari kubus 6x6x6 dan dari skala abu-abu
+					int cube = 16 + 36 * level(red) + 6 * level(green) + level(blue);
+					int gray = 232 + std::min(std::max(((red + green + blue) / 3 - 3) / 10, 0), 23);
+
+					int r, g, b, rr, gg, bb;
+					palette256(cube, r, g, b);
+					palette256(gray, rr, gg, bb);
+					result[i] = static_cast<unsigned char>(
+						distance(red, green, blue, r, g, b) <= distance(red, green, blue, rr, gg, bb) ? cube : gray
+						);
+				}
+
+				return result;
+			}();
+
+			return table.data();
+		}
+		static auto lookup16() -> const unsigned char* {
+			static const std::vector<unsigned char> table = [] {
+				std::vector<unsigned char> result(32 * 32 * 32);
+
+				for (int i = 0; i < 32 * 32 * 32; ++i) {
+					int red = (i >> 10) << 3 | 4, green = (i >> 5 & 31) << 3 | 4, blue = (i & 31) << 3 | 4;
+					int best = 0;
+					int bestDistance = std::numeric_limits<int>::max();
+
+					for (int index = 0; index < 16; ++index) {
+						int r, g, b;
+						palette256(index, r, g, b);
+
+						int current = distance(red, green, blue, r, g, b);
+						if (current < bestDistance) {
+							best = index;
+							bestDistance = current;
+						}
+					}
+
+					result[i] = static_cast<unsigned char>(best);
+				}
+
+				return result;
+			}();
+
+			return table.data();
+		}
 	};
 	class Pixel final {
 	public:
@@ -459,7 +646,7 @@ namespace Simple {
 			Background(background),
 			Value(std::move(value)) {
 		}
-		auto operator ==(const Pixel& other) -> bool {
+		auto operator ==(const Pixel& other) const -> bool {
 			return
 				this->Bold == other.Bold &&
 				this->Dim == other.Dim &&
@@ -472,7 +659,7 @@ namespace Simple {
 				this->Foreground == other.Foreground &&
 				this->Background == other.Background;
 		}
-		auto operator !=(const Pixel& other) -> bool {
+		auto operator !=(const Pixel& other) const -> bool {
 			return !(*this == other);
 		}
 
@@ -489,890 +676,4935 @@ namespace Simple {
 		Color Background = Palette16::Default;
 		std::string Value = " ";
 	};
-	class Buffer final {
-	public:
-		Buffer(int height, int width) :
-			height(height),
-			width(width),
-			pixels(height* width) {
-		}
-		Buffer(int height, int width, Pixel style) :
-			height(height),
-			width(width),
-			style(style),
-			pixels(height* width, style) {
-		}
-		auto At(int y, int x) -> Pixel& {
-			static Pixel dummy;
-			if (y >= this->height || x >= this->width) {
-				return dummy;
+	namespace Utility {
+		// Thread pool untuk parallel-for, thread pemanggil ikut mengerjakan task
+		class ThreadPool final {
+		public:
+			ThreadPool(int threads = static_cast<int>(std::thread::hardware_concurrency())) {
+				for (int i = 1; i < threads; ++i) {
+					this->threads.emplace_back([this] { this->loop(); });
+				}
 			}
-
-			return this->pixels[y * this->width + x];
-		}
-		auto ToString() -> const std::string {
-			std::string result;
-			Pixel prevPixel;
-
-			for (int y = 0; y < this->height; ++y) {
-				if (y > 0) {
-					result += "\n";
+			~ThreadPool() {
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->stopping = true;
 				}
+				this->wake.notify_all();
 
-				for (int x = 0; x < this->width; ++x) {
-					Pixel& nextPixel = this->pixels[y * this->width + x];
-
-					// Mengatur atribut pixel
-					if (prevPixel.Bold != nextPixel.Bold) {
-						result += nextPixel.Bold ? "\x1b[1m" : "\x1b[22m";
-					}
-					if (prevPixel.Dim != nextPixel.Dim) {
-						result += nextPixel.Dim ? "\x1b[2m" : "\x1b[22m";
-					}
-					if (prevPixel.Italic != nextPixel.Italic) {
-						result += nextPixel.Italic ? "\x1b[3m" : "\x1b[23m";
-					}
-					if (prevPixel.Underline != nextPixel.Underline) {
-						result += nextPixel.Underline ? "\x1b[4m" : "\x1b[24m";
-					}
-					if (prevPixel.Blink != nextPixel.Blink) {
-						result += nextPixel.Blink ? "\x1b[5m" : "\x1b[25m";
-					}
-					if (prevPixel.Invert != nextPixel.Invert) {
-						result += nextPixel.Invert ? "\x1b[7m" : "\x1b[27m";
-					}
-					if (prevPixel.Invisible != nextPixel.Invisible) {
-						result += nextPixel.Invisible ? "\x1b[8m" : "\x1b[28m";
-					}
-					if (prevPixel.Strikethrough != nextPixel.Strikethrough) {
-						result += nextPixel.Strikethrough ? "\x1b[9m" : "\x1b[29m";
+				for (std::thread& thread : this->threads) {
+					thread.join();
+				}
+			}
+			ThreadPool(const ThreadPool&) = delete;
+			auto operator =(const ThreadPool&) -> ThreadPool& = delete;
+
+			// Jalankan task(i) untuk i dari 0 sampai count - 1 dan tunggu sampai semua selesai
+			auto For(int count, const std::function<void(int)>& task) -> void {
+				// Pemanggilan dari dalam worker dijalankan serial agar tidak deadlock
+				if (count <= 1 || this->threads.empty() || Worker()) {
+					for (int i = 0; i < count; ++i) {
+						task(i);
 					}
+					return;
+				}
 
-					// Mengatur warna pixel
-					if (prevPixel.Foreground != nextPixel.Foreground) {
-						result += nextPixel.Foreground.Foreground();
-					}
-					if (prevPixel.Background != nextPixel.Background) {
-						result += nextPixel.Background.Background();
-					}
+				// Pemanggil dari thread lain (misalnya pencarian di background) menunggu giliran
+				std::lock_guard<std::mutex> call(this->calls);
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->done.wait(lock, [this] { return this->active == 0; });
+				this->job = &task;
+				this->count = count;
+				this->next = 0;
+				this->pending = count;
+				++this->generation;
+				lock.unlock();
+				this->wake.notify_all();
+
+				// Selama ikut bekerja, pemanggil diperlakukan seperti worker agar For bersarang berjalan serial
+				Worker() = true;
+				this->work(&task, count);
+				Worker() = false;
+
+				lock.lock();
+				this->done.wait(lock, [this] { return this->pending == 0 && this->active == 0; });
+			}
+			auto Size() -> int {
+				return static_cast<int>(this->threads.size()) + 1;
+			}
 
-					result += nextPixel.Value;
+			// Pool yang dipakai layout dan serializer, nullptr berarti serial
+			static auto Current() -> ThreadPool*& {
+				static ThreadPool* current = nullptr;
+				return current;
+			}
+			// Jalankan pada pool aktif, atau serial jika tidak ada
+			static auto Run(int count, const std::function<void(int)>& task) -> void {
+				if (ThreadPool* pool = Current()) {
+					pool->For(count, task);
+					return;
+				}
 
-					prevPixel = nextPixel;
+				for (int i = 0; i < count; ++i) {
+					task(i);
 				}
 			}
-			result += "\x1b[m";
 
-			return std::move(result);
-		}
-		auto Render(std::ostringstream& ostr) {
-			Pixel prevPixel;
+		private:
+			static auto Worker() -> bool& {
+				static thread_local bool worker = false;
+				return worker;
+			}
+			auto loop() -> void {
+				Worker() = true;
+				uint64_t seen = 0;
+
+				while (true) {
+					std::unique_lock<std::mutex> lock(this->mutex);
+					this->wake.wait(lock, [&] { return this->stopping || this->generation != seen; });
+					if (this->stopping) {
+						return;
+					}
 
-			for (int y = 0; y < this->height; ++y) {
-				if (y > 0) {
-					ostr << "\n";
-				}
+					seen = this->generation;
+					const std::function<void(int)>* job = this->job;
+					int count = this->count;
+					++this->active;
+					lock.unlock();
 
-				for (int x = 0; x < this->width; ++x) {
-					Pixel& nextPixel = this->pixels[y * this->width + x];
+					this->work(job, count);
 
-					// Mengatur atribut pixel
-					if (prevPixel.Bold != nextPixel.Bold) {
-						ostr << (nextPixel.Bold ? "\x1b[1m" : "\x1b[22m");
-					}
-					if (prevPixel.Dim != nextPixel.Dim) {
-						ostr << (nextPixel.Dim ? "\x1b[2m" : "\x1b[22m");
-					}
-					if (prevPixel.Italic != nextPixel.Italic) {
-						ostr << (nextPixel.Italic ? "\x1b[3m" : "\x1b[23m");
-					}
-					if (prevPixel.Underline != nextPixel.Underline) {
-						ostr << (nextPixel.Underline ? "\x1b[4m" : "\x1b[24m");
-					}
-					if (prevPixel.Blink != nextPixel.Blink) {
-						ostr << (nextPixel.Blink ? "\x1b[5m" : "\x1b[25m");
-					}
-					if (prevPixel.Invert != nextPixel.Invert) {
-						ostr << (nextPixel.Invert ? "\x1b[7m" : "\x1b[27m");
+					lock.lock();
+					if (--this->active == 0) {
+						this->done.notify_all();
 					}
-					if (prevPixel.Invisible != nextPixel.Invisible) {
-						ostr << (nextPixel.Invisible ? "\x1b[8m" : "\x1b[28m");
-					}
-					if (prevPixel.Strikethrough != nextPixel.Strikethrough) {
-						ostr << (nextPixel.Strikethrough ? "\x1b[9m" : "\x1b[29m");
+				}
+			}
+			auto work(const std::function<void(int)>* job, int count) -> void {
+				while (true) {
+					int index = this->next.fetch_add(1);
+					if (index >= count) {
+						return;
 					}
 
-					// Mengatur warna pixel
-					if (prevPixel.Foreground != nextPixel.Foreground) {
-						nextPixel.Foreground.Foreground(ostr);
-					}
-					if (prevPixel.Background != nextPixel.Background) {
-						nextPixel.Background.Background(ostr);
+					(*job)(index);
+
+					if (this->pending.fetch_sub(1) == 1) {
+						std::lock_guard<std::mutex> lock(this->mutex);
+						this->done.notify_all();
 					}
+				}
+			}
 
-					ostr << nextPixel.Value;
+		private:
+			std::vector<std::thread> threads;
+			std::mutex calls;
+			std::mutex mutex;
+			std::condition_variable wake;
+			std::condition_variable done;
+			const std::function<void(int)>* job = nullptr;
+			int count = 0;
+			int active = 0;
+			bool stopping = false;
+			uint64_t generation = 0;
+			std::atomic<int> next = 0;
+			std::atomic<int> pending = 0;
+		};
+	}
 
-					prevPixel = nextPixel;
+	namespace Utility {
+		// Index cell pertama mulai dari 'from' yang berbeda antara a dan b, atau count jika semua sama.
+		// Satu cell adalah dua word 64-bit yang dihasilkan Presenter
+		inline auto Mismatch(const uint64_t* a, const uint64_t* b, int from, int count) -> int {
+#if defined(__AVX2__)
+			for (; from + 2 <= count; from += 2) {
+				__m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + from * 2));
+				__m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + from * 2));
+				unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)));
+				if (mask != 0xFFFFFFFFu) {
+					return from + ((mask & 0xFFFFu) == 0xFFFFu ? 1 : 0);
+				}
+			}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			for (; from < count; ++from) {
+				__m128i left = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + from * 2));
+				__m128i right = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + from * 2));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(left, right)) != 0xFFFF) {
+					return from;
+				}
+			}
+#endif
+			for (; from < count; ++from) {
+				if (a[from * 2] != b[from * 2] || a[from * 2 + 1] != b[from * 2 + 1]) {
+					return from;
 				}
 			}
-		}
-		auto Height() -> const int& {
-			return this->height;
-		}
-		auto Width() -> const int& {
-			return this->width;
-		}
-		auto Style() -> const Pixel& {
-			return this->style;
-		}
-		auto Clear() -> void {
-			std::fill(this->pixels.begin(), this->pixels.end(), this->style);
-		}
 
-	private:
-		int height = 0;
-		int width = 0;
-		Pixel style;
-		std::vector<Pixel> pixels;
-	};
+			return count;
+		}
+	}
 
-	class SelectableGroup;
-	namespace Base {
-		class Renderable {
-		public:
-			virtual auto Init() -> void {}
-			virtual auto Set(Rectangle dimension) -> void {
-				this->Dimension = dimension;
-			}
-			virtual auto Render(Buffer&) -> void {}
+	// Encoder SGR: transisi style antar pixel ditulis sebagai satu CSI sependek mungkin
+	class StyleEncoder final {
+	public:
+		static auto Encode(std::string& output, const Pixel& prev, const Pixel& next) -> void {
+			char incremental[96];
+			char reset[96];
+			char* inc = incremental;
+			char* rst = reset;
+
+			auto append = [](char*& cursor, const char* value) {
+				if (*value == '\0') {
+					return;
+				}
+				while (*value) {
+					*cursor++ = *value++;
+				}
+				*cursor++ = ';';
+			};
+			auto flag = [&](bool before, bool after, const char* on, const char* off) {
+				if (before != after) {
+					append(inc, after ? on : off);
+				}
+				if (after) {
+					append(rst, on);
+				}
+			};
 
-		public:
-			int Height = 0;
-			int Width = 0;
-			int FlexY = 0;
-			int FlexX = 0;
-			Rectangle Dimension;
-		};
-		class Focusable {
-		public:
-			auto Focused() -> const bool& {
-				return this->focused;
+			// 22 mematikan Bold dan Dim sekaligus, jadi yang masih aktif harus dinyalakan ulang
+			if ((prev.Bold && !next.Bold) || (prev.Dim && !next.Dim)) {
+				append(inc, "22");
+				append(inc, next.Bold ? "1" : "");
+				append(inc, next.Dim ? "2" : "");
 			}
-			virtual auto Focused(bool flag) -> void {
-				this->focused = flag;
+			else {
+				append(inc, !prev.Bold && next.Bold ? "1" : "");
+				append(inc, !prev.Dim && next.Dim ? "2" : "");
 			}
-			virtual auto OnKey(const KEY_EVENT_RECORD&) -> bool {
-				return false;
+			append(rst, "0");
+			append(rst, next.Bold ? "1" : "");
+			append(rst, next.Dim ? "2" : "");
+			flag(prev.Italic, next.Italic, "3", "23");
+			flag(prev.Underline, next.Underline, "4", "24");
+			flag(prev.Blink, next.Blink, "5", "25");
+			flag(prev.Invert, next.Invert, "7", "27");
+			flag(prev.Invisible, next.Invisible, "8", "28");
+			flag(prev.Strikethrough, next.Strikethrough, "9", "29");
+
+			if (prev.Foreground != next.Foreground) {
+				inc = next.Foreground.Parameters(inc, false);
+				*inc++ = ';';
 			}
-
-		private:
-			bool focused = false;
-		};
-		class Selectable {
-		public:
-			Selectable() = default;
-			Selectable(std::string name) :
-				name(std::move(name)) {
+			if (!next.Foreground.IsDefault()) {
+				rst = next.Foreground.Parameters(rst, false);
+				*rst++ = ';';
 			}
-			auto Selected() -> const bool& {
-				return this->selected;
+			if (prev.Background != next.Background) {
+				inc = next.Background.Parameters(inc, true);
+				*inc++ = ';';
 			}
-			virtual auto Selected(bool flag) -> void {
-				this->selected = flag;
+			if (!next.Background.IsDefault()) {
+				rst = next.Background.Parameters(rst, true);
+				*rst++ = ';';
 			}
-			auto SetGroup(SelectableGroup* group) -> void {
-				this->group = group;
+
+			if (inc == incremental) {
+				return;
 			}
-			auto Name() -> const std::string& {
-				return this->name;
+
+			// Pilih reset-lalu-set jika lebih pendek dari perubahan bertahap
+			char* begin = incremental;
+			char* end = inc;
+			if (rst - reset < inc - incremental) {
+				begin = reset;
+				end = rst;
 			}
 
-		protected:
-			std::string name;
-			SelectableGroup* group = nullptr;
+			output += "\x1b[";
+			output.append(begin, end - 1);
+			output += 'm';
+		}
+	};
+	// Lebar tampilan code point dan pemisahan grapheme cluster.
+	// Tabel dua tingkat dibangun saat compile dari daftar range, lookup cukup dua akses array
+	namespace Unicode {
+		class Range final {
+		public:
+			uint32_t First;
+			uint32_t Last;
+			int Columns;
+		};
 
-		private:
-			bool selected = false;
+		// Ringkasan East Asian Wide/Fullwidth, emoji, dan tanda gabung (lebar 0).
+		// Code point yang tidak tercantum lebarnya 1
+		constexpr Range Ranges[] = {
+			{ 0x0300, 0x036F, 0 }, { 0x0483, 0x0489, 0 }, { 0x0591, 0x05BD, 0 }, { 0x05BF, 0x05BF, 0 },
+			{ 0x05C1, 0x05C2, 0 }, { 0x05C4, 0x05C5, 0 }, { 0x05C7, 0x05C7, 0 }, { 0x0610, 0x061A, 0 },
+			{ 0x064B, 0x065F, 0 }, { 0x0670, 0x0670, 0 }, { 0x06D6, 0x06DC, 0 }, { 0x06DF, 0x06E4, 0 },
+			{ 0x06E7, 0x06E8, 0 }, { 0x06EA, 0x06ED, 0 }, { 0x0900, 0x0902, 0 }, { 0x093A, 0x093A, 0 },
+			{ 0x093C, 0x093C, 0 }, { 0x0941, 0x0948, 0 }, { 0x094D, 0x094D, 0 }, { 0x0951, 0x0957, 0 },
+			{ 0x0962, 0x0963, 0 }, { 0x0E31, 0x0E31, 0 }, { 0x0E34, 0x0E3A, 0 }, { 0x0E47, 0x0E4E, 0 },
+			{ 0x1160, 0x11FF, 0 }, { 0x1AB0, 0x1AFF, 0 }, { 0x1DC0, 0x1DFF, 0 }, { 0x200B, 0x200F, 0 },
+			{ 0x20D0, 0x20FF, 0 }, { 0xFE00, 0xFE0F, 0 }, { 0xFE20, 0xFE2F, 0 }, { 0xFEFF, 0xFEFF, 0 },
+			{ 0x1F3FB, 0x1F3FF, 0 }, { 0xE0000, 0xE007F, 0 }, { 0xE0100, 0xE01EF, 0 },
+
+			{ 0x1100, 0x115F, 2 }, { 0x231A, 0x231B, 2 }, { 0x2329, 0x232A, 2 }, { 0x23E9, 0x23EC, 2 },
+			{ 0x23F0, 0x23F0, 2 }, { 0x23F3, 0x23F3, 2 }, { 0x25FD, 0x25FE, 2 }, { 0x2614, 0x2615, 2 },
+			{ 0x2648, 0x2653, 2 }, { 0x267F, 0x267F, 2 }, { 0x2693, 0x2693, 2 }, { 0x26A1, 0x26A1, 2 },
+			{ 0x26AA, 0x26AB, 2 }, { 0x26BD, 0x26BE, 2 }, { 0x26C4, 0x26C5, 2 }, { 0x26CE, 0x26CE, 2 },
+			{ 0x26D4, 0x26D4, 2 }, { 0x26EA, 0x26EA, 2 }, { 0x26F2, 0x26F3, 2 }, { 0x26F5, 0x26F5, 2 },
+			{ 0x26FA, 0x26FA, 2 }, { 0x26FD, 0x26FD, 2 }, { 0x2705, 0x2705, 2 }, { 0x270A, 0x270B, 2 },
+			{ 0x2728, 0x2728, 2 }, { 0x274C, 0x274C, 2 }, { 0x274E, 0x274E, 2 }, { 0x2753, 0x2755, 2 },
+			{ 0x2757, 0x2757, 2 }, { 0x2795, 0x2797, 2 }, { 0x27B0, 0x27B0, 2 }, { 0x27BF, 0x27BF, 2 },
+			{ 0x2B1B, 0x2B1C, 2 }, { 0x2B50, 0x2B50, 2 }, { 0x2B55, 0x2B55, 2 }, { 0x2E80, 0x303E, 2 },
+			{ 0x3041, 0x33FF, 2 }, { 0x3400, 0x4DBF, 2 }, { 0x4E00, 0x9FFF, 2 }, { 0xA000, 0xA4CF, 2 },
+			{ 0xA960, 0xA97F, 2 }, { 0xAC00, 0xD7A3, 2 }, { 0xF900, 0xFAFF, 2 }, { 0xFE10, 0xFE19, 2 },
+			{ 0xFE30, 0xFE6F, 2 }, { 0xFF00, 0xFF60, 2 }, { 0xFFE0, 0xFFE6, 2 }, { 0x16FE0, 0x16FE4, 2 },
+			{ 0x17000, 0x18CFF, 2 }, { 0x1B000, 0x1B2FF, 2 }, { 0x1F004, 0x1F004, 2 }, { 0x1F0CF, 0x1F0CF, 2 },
+			{ 0x1F18E, 0x1F18E, 2 }, { 0x1F191, 0x1F19A, 2 }, { 0x1F1E6, 0x1F1FF, 2 }, { 0x1F200, 0x1F251, 2 },
+			{ 0x1F300, 0x1F3FA, 2 }, { 0x1F400, 0x1F64F, 2 }, { 0x1F680, 0x1F6FF, 2 }, { 0x1F7E0, 0x1F7EB, 2 },
+			{ 0x1F90C, 0x1F9FF, 2 }, { 0x1FA70, 0x1FAFF, 2 }, { 0x20000, 0x2FFFD, 2 }, { 0x30000, 0x3FFFD, 2 }
 		};
-		class Modifier : public Renderable {
-		public:
-			Modifier(std::shared_ptr<Renderable> element) :
-				element(std::move(element)) {
-			}
 
-			virtual auto Init() -> void override {
-				this->element->Init();
-				Renderable::Height = this->element->Height;
-				Renderable::Width = this->element->Width;
+		constexpr uint32_t Blocks = 0x110000 >> 8;
+
+		// Block 256 code point yang seluruhnya satu lebar memakai block bersama 0, 1, atau 2 (sesuai lebarnya),
+		// sisanya (3) mendapat block sendiri
+		constexpr auto kinds() -> std::array<uint8_t, Blocks> {
+			std::array<uint8_t, Blocks> result{};
+			std::array<bool, Blocks> touched{};
+			for (auto& kind : result) {
+				kind = 1;
 			}
-			virtual auto Set(Rectangle dimension) -> void override {
-				this->element->Set(dimension);
-				Renderable::Set(dimension);
+
+			for (const Range& range : Ranges) {
+				for (uint32_t block = range.First >> 8; block <= range.Last >> 8; ++block) {
+					bool full = range.First <= block << 8 && range.Last >= (block << 8 | 0xFF);
+					result[block] = full && !touched[block] ? static_cast<uint8_t>(range.Columns) : 3;
+					touched[block] = true;
+				}
 			}
-			virtual auto Render(Buffer& buf) -> void override {
-				this->element->Render(buf);
+
+			return result;
+		}
+		constexpr auto mixed() -> size_t {
+			size_t count = 0;
+			for (uint8_t kind : kinds()) {
+				count += kind == 3;
 			}
 
-		protected:
-			std::shared_ptr<Renderable> element;
-		};
-	}
-	namespace Utility {
-		template<class Type, class... Args>
-		std::vector<Type> ToVector(Args&&... args) {
-			return std::vector<Type>{ std::forward<Args>(args)... };
+			return count;
 		}
-	}
 
-	class SelectableGroup final {
-	public:
-		SelectableGroup(std::vector<std::shared_ptr<Base::Selectable>> components) {
-			for (auto& component : components) {
-				component->SetGroup(this);
-				this->components.push_back(std::move(component));
+		template<size_t Count>
+		class Table final {
+		public:
+			std::array<uint8_t, Blocks> Stage1{};
+			// Dua bit per code point, 64 byte per block
+			std::array<uint8_t, Count * 64> Stage2{};
+		};
+
+		constexpr auto build() -> Table<3 + mixed()> {
+			Table<3 + mixed()> table{};
+			std::array<uint8_t, Blocks> kind = kinds();
+
+			for (int columns = 0; columns < 3; ++columns) {
+				for (int i = 0; i < 64; ++i) {
+					table.Stage2[columns * 64 + i] = static_cast<uint8_t>(columns * 0x55);
+				}
 			}
-		}
-		void Clear() {
-			for (const auto& component : this->components) {
-				component->Selected(false);
+
+			uint8_t next = 3;
+			for (uint32_t block = 0; block < Blocks; ++block) {
+				if (kind[block] != 3) {
+					table.Stage1[block] = kind[block];
+					continue;
+				}
+
+				table.Stage1[block] = next;
+				for (int i = 0; i < 64; ++i) {
+					table.Stage2[next * 64 + i] = 0x55;
+				}
+				++next;
 			}
-		}
-		auto Selected() -> const std::shared_ptr<Base::Selectable>& {
-			for (const auto& component : this->components) {
-				if (component->Selected()) {
-					return component;
+
+			for (const Range& range : Ranges) {
+				for (uint32_t cp = range.First; cp <= range.Last; ++cp) {
+					if (kind[cp >> 8] != 3) {
+						cp |= 0xFF;
+						continue;
+					}
+
+					uint8_t& entry = table.Stage2[table.Stage1[cp >> 8] * 64 + (cp & 0xFF) / 4];
+					int shift = (cp & 3) * 2;
+					entry = static_cast<uint8_t>((entry & ~(3 << shift)) | range.Columns << shift);
 				}
 			}
+
+			return table;
 		}
 
-	private:
-		std::vector<std::shared_ptr<Base::Selectable>> components;
-	};
+		inline constexpr auto table = build();
+		static_assert(3 + mixed() <= 256, "Stage1 hanya menyimpan index block 8 bit");
 
-	class VerticalLayout final : public Base::Renderable {
-	public:
-		VerticalLayout(std::vector<std::shared_ptr<Renderable>> elements) :
-			elements(std::move(elements)) {
+		constexpr auto Columns(uint32_t cp) -> int {
+			if (cp >= 0x110000) {
+				return 1;
+			}
+
+			return table.Stage2[table.Stage1[cp >> 8] * 64 + (cp & 0xFF) / 4] >> (cp & 3) * 2 & 3;
 		}
 
-		auto Init() -> void override {
-			Renderable::Height = 0;
-			Renderable::Width = 0;
-			Renderable::FlexX = 0;
-			Renderable::FlexY = 0;
+		// Decode satu code point UTF-8, byte yang tidak valid menjadi U+FFFD
+		inline auto Decode(std::string_view text, size_t& pos) -> uint32_t {
+			unsigned char lead = static_cast<unsigned char>(text[pos++]);
+			int length = lead < 0x80 ? 0 : lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : -1;
+			if (length == 0) {
+				return lead;
+			}
+			if (length < 0 || pos + length > text.size()) {
+				return 0xFFFD;
+			}
 
-			for (const auto& element : this->elements) {
-				element->Init();
+			uint32_t cp = lead & (0x3F >> length);
+			for (int i = 0; i < length; ++i) {
+				unsigned char byte = static_cast<unsigned char>(text[pos]);
+				if ((byte & 0xC0) != 0x80) {
+					return 0xFFFD;
+				}
 
-				Renderable::Height += element->Height;
-				Renderable::Width = std::max(Renderable::Width, element->Width);
-				Renderable::FlexX += element->FlexX;
-				Renderable::FlexY += element->FlexY;
+				cp = cp << 6 | (byte & 0x3F);
+				++pos;
+			}
+
+			return cp;
+		}
+
+		inline auto Encode(uint32_t cp, std::string& output) -> void {
+			if (cp < 0x80) {
+				output += static_cast<char>(cp);
+			}
+			else if (cp < 0x800) {
+				output += static_cast<char>(0xC0 | cp >> 6);
+				output += static_cast<char>(0x80 | (cp & 0x3F));
+			}
+			else if (cp < 0x10000) {
+				output += static_cast<char>(0xE0 | cp >> 12);
+				output += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+				output += static_cast<char>(0x80 | (cp & 0x3F));
+			}
+			else {
+				output += static_cast<char>(0xF0 | cp >> 18);
+				output += static_cast<char>(0x80 | (cp >> 12 & 0x3F));
+				output += static_cast<char>(0x80 | (cp >> 6 & 0x3F));
+				output += static_cast<char>(0x80 | (cp & 0x3F));
 			}
 		}
-		auto Set(Rectangle dimension) -> void override {
-			Renderable::Set(dimension);
 
-			int spaceY = (Renderable::Dimension.Bottom - Renderable::Dimension.Top - Renderable::Height) / (Renderable::FlexY == 0 ? 1 : Renderable::FlexY);
-			int spaceX = (Renderable::Dimension.Right - Renderable::Dimension.Left - Renderable::Width) / (Renderable::FlexX == 0 ? 1 : Renderable::FlexX);
+		// Maju satu grapheme cluster: code point dasar diikuti tanda gabung, sambungan ZWJ, atau pasangan
+		// regional indicator. Mengembalikan lebar cluster dalam kolom
+		inline auto Cluster(std::string_view text, size_t& pos) -> int {
+			auto regional = [](uint32_t cp) { return cp >= 0x1F1E6 && cp <= 0x1F1FF; };
 
-			for (const auto& element : this->elements) {
-				if (element->FlexX == 1) {
-					//dimension.Right = dimension.Left + Renderable::Dimension.Right;
-				}
-				else {
-					dimension.Right = dimension.Left + element->Width;
-				}
+			uint32_t cp = Decode(text, pos);
+			int columns = Columns(cp);
+			bool pair = regional(cp);
 
-				if (element->FlexY == 1) {
-					dimension.Bottom = dimension.Top + element->Height + spaceY;
+			while (pos < text.size()) {
+				size_t peek = pos;
+				uint32_t next = Decode(text, peek);
+
+				if (pair && regional(next)) {
+					pair = false;
 				}
-				else {
-					dimension.Bottom = dimension.Top + element->Height;
+				else if (cp != 0x200D && Columns(next) != 0) {
+					break;
 				}
 
-				element->Set(dimension);
+				// Variation selector 16 meminta tampilan emoji yang lebarnya dua kolom
+				if (next == 0xFE0F) {
+					columns = 2;
+				}
 
-				dimension.Top = dimension.Bottom;
+				pos = peek;
+				cp = next;
 			}
+
+			return columns;
 		}
-		auto Render(Buffer& buf) -> void override {
-			for (const auto& element : this->elements) {
-				element->Render(buf);
+		// Lebar text dalam kolom, simpan hasilnya jika text jarang berubah
+		inline auto Columns(std::string_view text) -> int {
+			int columns = 0;
+			for (size_t pos = 0; pos < text.size(); ) {
+				columns += Cluster(text, pos);
 			}
-		}
 
-	private:
-		std::vector<std::shared_ptr<Renderable>> elements;
-	};
-	class HorizontalLayout final : public Base::Renderable {
+			return columns;
+		}
+	}
+	class Buffer final {
 	public:
-		HorizontalLayout(std::vector<std::shared_ptr<Renderable>> elements) :
-			elements(std::move(elements)) {
+		Buffer(int height, int width) :
+			height(height),
+			width(width),
+			pixels(height* width) {
+		}
+		Buffer(int height, int width, Pixel style) :
+			height(height),
+			width(width),
+			style(style),
+			pixels(height* width, style) {
 		}
+		auto At(int y, int x) -> Pixel& {
+			static thread_local Pixel dummy;
+			if (y >= this->height || x >= this->width) {
+				return dummy;
+			}
 
-		auto Init() -> void override {
-			Renderable::Height = 0;
-			Renderable::Width = 0;
-			Renderable::FlexX = 0;
-			Renderable::FlexY = 0;
+			return this->pixels[y * this->width + x];
+		}
+		auto ToString() -> const std::string {
+			std::string result;
 
-			for (const auto& element : this->elements) {
-				element->Init();
+			this->encode(result);
+			result += "\x1b[m";
 
-				Renderable::Height = std::max(Renderable::Height, element->Height);
-				Renderable::Width += element->Width;
-				Renderable::FlexX += element->FlexX;
-				Renderable::FlexY += element->FlexY;
-			}
+			return std::move(result);
 		}
-		auto Set(Rectangle dimension) -> void override {
-			Renderable::Set(dimension);
+		auto Render(std::ostringstream& ostr) {
+			std::string result;
+
+			this->encode(result);
+			ostr << result;
+		}
+		// Tulis pixel [begin, end) pada baris y, prevPixel adalah style terakhir di terminal
+		auto Encode(std::string& result, int y, int begin, int end, const Pixel*& prevPixel) -> void {
+			const Pixel* row = this->Row(y);
 
-			int spaceY = (Renderable::Dimension.Bottom - Renderable::Dimension.Top - Renderable::Height) / (Renderable::FlexY == 0 ? 1 : Renderable::FlexY);
-			int spaceX = (Renderable::Dimension.Right - Renderable::Dimension.Left - Renderable::Width) / (Renderable::FlexX == 0 ? 1 : Renderable::FlexX);
+			for (int x = begin; x < end; ++x) {
+				const Pixel& nextPixel = row[x];
 
-			for (const auto& element : this->elements) {
-				if (element->FlexX == 1) {
-					dimension.Right = dimension.Left + element->Width + spaceX;
+				StyleEncoder::Encode(result, *prevPixel, nextPixel);
+
+				// Hitung panjang deretan pixel identik
+				int count = 1;
+				while (x + count < end && row[x + count] == nextPixel && row[x + count].Value == nextPixel.Value) {
+					++count;
 				}
-				else {
-					dimension.Right = dimension.Left + element->Width;
+				this->run(result, nextPixel, count, x + count == end);
+
+				x += count - 1;
+				prevPixel = &nextPixel;
+			}
+		}
+		// Tulis seluruh buffer, baris dibagi menjadi band yang di-encode paralel jika ada thread pool
+		auto Encode(std::string& result) -> void {
+			static const Pixel reset;
+			Utility::ThreadPool* pool = Utility::ThreadPool::Current();
+			int bands = pool != nullptr && this->height * this->width >= 8192 ? std::min(pool->Size() * 2, this->height) : 1;
+
+			static thread_local std::vector<std::string> buffers;
+			std::vector<std::string>& chunks = buffers;
+			chunks.resize(bands);
+			Utility::ThreadPool::Run(bands, [this, bands, &chunks](int band) {
+				std::string& chunk = chunks[band];
+				int begin = band * this->height / bands;
+				int end = (band + 1) * this->height / bands;
+
+				// Style awal band sama dengan pixel terakhir baris sebelumnya
+				const Pixel* prevPixel = begin > 0 && this->width > 0 ? &this->Row(begin - 1)[this->width - 1] : &reset;
+				chunk.clear();
+				for (int y = begin; y < end; ++y) {
+					if (y > 0) {
+						chunk += "\n";
+					}
+
+					this->Encode(chunk, y, 0, this->width, prevPixel);
 				}
+				});
 
-				if (element->FlexY == 1) {
-					//dimension.Bottom = dimension.Top + element->Height + spaceY;
+			for (int band = 0; band < bands; ++band) {
+				result += chunks[band];
+			}
+		}
+		auto Row(int y) -> Pixel* {
+			return this->pixels.data() + y * this->width;
+		}
+		// Tulis text per grapheme cluster mulai kolom x hingga sebelum kolom right, kembalikan jumlah byte yang
+		// tertulis. Karakter lebar menempati dua cell, cell kedua dikosongkan sebagai lanjutan
+		auto Write(int y, int x, int right, std::string_view text) -> size_t {
+			return this->Write(y, x, right, text, [](Pixel&, size_t) {});
+		}
+		// Sama seperti Write, paint(pixel, offset) dipanggil untuk setiap cell dengan offset byte awal cluster
+		template<class Paint>
+		auto Write(int y, int x, int right, std::string_view text, Paint&& paint) -> size_t {
+			size_t pos = 0;
+			while (pos < text.size()) {
+				size_t begin = pos;
+				int columns = Unicode::Cluster(text, pos);
+				if (x + columns > right) {
+					return begin;
 				}
-				else {
-					dimension.Bottom = dimension.Top + element->Height;
+				if (columns == 0) {
+					continue;
 				}
 
-				element->Set(dimension);
-
-				dimension.Left = dimension.Right;
+				for (int i = 0; i < columns; ++i) {
+					Pixel& pixel = this->At(y, x + i);
+					if (i == 0) {
+						pixel.Value.assign(text.data() + begin, pos - begin);
+					}
+					else {
+						pixel.Value.clear();
+					}
+					paint(pixel, begin);
+				}
+				x += columns;
 			}
+
+			return pos;
 		}
-		auto Render(Buffer& buf) -> void override {
-			for (const auto& element : this->elements) {
-				element->Render(buf);
-			}
+		auto Height() -> const int& {
+			return this->height;
 		}
-
-	private:
-		std::vector<std::shared_ptr<Renderable>> elements;
-	};
-	class Text final : public Base::Renderable {
-	public:
-		Text(std::string value) :
-			value(std::move(value)) {
+		auto Width() -> const int& {
+			return this->width;
 		}
-
-		auto Init() -> void override {
-			Renderable::Height = 1;
-			Renderable::Width = static_cast<int>(this->value.size());
+		auto Style() -> const Pixel& {
+			return this->style;
 		}
-		auto Render(Buffer& buf) -> void {
-			// Render value kedalam buffer
-			for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
-					if (i < this->value.size()) {
-						buf.At(y, x).Value = this->value[i];
-					}
-					else { return; }
+		auto Clear() -> void {
+			std::fill(this->pixels.begin(), this->pixels.end(), this->style);
+		}
+		// Ubah ukuran tanpa melepas kapasitas yang sudah ada
+		auto Resize(int height, int width) -> void {
+			this->height = height;
+			this->width = width;
+			this->pixels.assign(static_cast<size_t>(height) * width, this->style);
+		}
+
+	private:
+		// Tulis deretan pixel identik dengan cara terpendek: literal, REP, atau ECH
+		auto run(std::string& result, const Pixel& pixel, int count, bool lineEnd) -> void {
+			const Capabilities& capabilities = Capabilities::Current();
+			size_t literal = pixel.Value.size() * count;
+
+			char repeat[16] = "\x1b[";
+			char* repeatEnd = std::to_chars(repeat + 2, repeat + sizeof(repeat), count - 1).ptr;
+			*repeatEnd++ = 'b';
+			size_t repeatSize = pixel.Value.size() + (repeatEnd - repeat);
+
+			// ECH hanya mewarisi background, jadi atribut lain tidak boleh aktif
+			char erase[32] = "\x1b[";
+			char* eraseEnd = std::to_chars(erase + 2, erase + 12, count).ptr;
+			*eraseEnd++ = 'X';
+			if (!lineEnd) {
+				*eraseEnd++ = '\x1b';
+				*eraseEnd++ = '[';
+				eraseEnd = std::to_chars(eraseEnd, eraseEnd + 10, count).ptr;
+				*eraseEnd++ = 'C';
+			}
+			size_t eraseSize = eraseEnd - erase;
+			bool erasable =
+				capabilities.Erase &&
+				pixel.Value == " " &&
+				!pixel.Invert &&
+				!pixel.Underline &&
+				!pixel.Strikethrough;
+
+			if (erasable && eraseSize < literal && (!capabilities.Repeat || eraseSize < repeatSize)) {
+				result.append(erase, eraseEnd);
+			}
+			else if (capabilities.Repeat && count > 1 && !pixel.Value.empty() && repeatSize < literal) {
+				result += pixel.Value;
+				result.append(repeat, repeatEnd);
+			}
+			else {
+				for (int i = 0; i < count; ++i) {
+					result += pixel.Value;
 				}
 			}
 		}
+		auto encode(std::string& result) -> void {
+			this->Encode(result);
+		}
 
 	private:
-		std::string value;
+		int height = 0;
+		int width = 0;
+		Pixel style;
+		std::vector<Pixel> pixels;
 	};
 
-	class VerticalContainer final : public Base::Focusable {
+	// Menulis frame sebagai selisih terhadap isi terminal dari frame sebelumnya
+	class Presenter final {
 	public:
-		VerticalContainer(std::vector<std::shared_ptr<Focusable>> components) :
-			components(std::move(components)) {
-		}
+		using Clock = std::chrono::steady_clock;
 
-		auto Focused(bool flag) -> void {
-			Focusable::Focused(flag);
+		auto Present(Buffer& next) -> const std::string& {
+			static const Pixel reset;
 
-			this->components[this->focusedComponent]->Focused(flag);
-		}
-		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
-			if (this->components[this->focusedComponent]->OnKey(keyEvent)) {
-				return true;
+			// Mode inline hanya menguasai inlineLines baris teratas dari buffer, sisanya diabaikan
+			if (this->inlineLines > 0 && next.Height() != this->inlineLines) {
+				this->region.Resize(this->inlineLines, next.Width());
+				for (int y = 0; y < std::min(this->inlineLines, next.Height()); ++y) {
+					std::copy(next.Row(y), next.Row(y) + next.Width(), this->region.Row(y));
+				}
+				return this->Present(this->region);
 			}
 
-			if (
-				((keyEvent.dwControlKeyState & SHIFT_PRESSED) && keyEvent.wVirtualKeyCode == VK_TAB) ||
-				keyEvent.wVirtualKeyCode == VK_UP ||
-				keyEvent.uChar.AsciiChar == 'k' ||
-				keyEvent.uChar.AsciiChar == 'K'
-				) {
-				if (this->focusedComponent > 0) {
-					this->components[this->focusedComponent]->Focused(false);
-					this->components[--this->focusedComponent]->Focused(true);
-					return true;
+			this->output.clear();
+
+			// Teks dari Print ditulis diatas region, region lalu digambar ulang dibawahnya
+			if (!this->printed.empty()) {
+				this->clearRegion();
+				this->output += this->printed;
+				if (this->printed.back() != '\n') {
+					this->output += "\n";
 				}
+				this->printed.clear();
+				this->screenHeight = 0;
+			}
 
-				return false;
+			// Ukuran berubah atau frame pertama, gambar ulang seluruh layar
+			if (this->screenHeight != next.Height() || this->screenWidth != next.Width()) {
+				// Region inline digambar ulang dari awal, sisa region lama yang lebih tinggi ikut dihapus
+				if (this->inlineLines > 0) {
+					this->moveUp(this->cursorY);
+					this->output += "\r\x1b[J";
+				}
+				else {
+					this->output += "\x1b[H";
+				}
+
+				next.Encode(this->output);
+				this->output += "\x1b[m";
+
+				this->cursorY = next.Height() - 1;
+				this->screenHeight = next.Height();
+				this->screenWidth = next.Width();
+				pack(next, this->screenCells);
+				hash(this->screenCells, this->screenHeight, this->screenWidth, this->screenHashes);
+				return this->output;
 			}
 
-			if (
-				keyEvent.wVirtualKeyCode == VK_TAB ||
-				keyEvent.wVirtualKeyCode == VK_DOWN ||
-				keyEvent.uChar.AsciiChar == 'j' ||
-				keyEvent.uChar.AsciiChar == 'J'
-				) {
-				if (this->focusedComponent < this->components.size() - 1) {
-					this->components[this->focusedComponent]->Focused(false);
-					this->components[++this->focusedComponent]->Focused(true);
-					return true;
+			pack(next, this->nextCells);
+			hash(this->nextCells, next.Height(), next.Width(), this->nextHashes);
+			if (this->inlineLines == 0) {
+				this->scroll();
+			}
+
+			// Mode inline memakai gerakan cursor relatif, jadi harus serial
+			Utility::ThreadPool* pool = Utility::ThreadPool::Current();
+			int height = next.Height();
+			int width = next.Width();
+			int count = pool != nullptr && this->inlineLines == 0 && height * next.Width() >= 8192 ? std::min(pool->Size() * 2, height) : 1;
+			this->bands.resize(count);
+
+			// Cari span yang berubah pada tiap band
+			Utility::ThreadPool::Run(count, [&](int index) {
+				Band& band = this->bands[index];
+				band.Spans.clear();
+
+				for (int y = index * height / count; y < (index + 1) * height / count; ++y) {
+					if (this->nextHashes[y] == this->screenHashes[y]) {
+						continue;
+					}
+
+					const uint64_t* before = this->screenCells.data() + static_cast<size_t>(y) * width * 2;
+					const uint64_t* after = this->nextCells.data() + static_cast<size_t>(y) * width * 2;
+					int x = Utility::Mismatch(before, after, 0, width);
+					while (x < width) {
+						// Cell lanjutan karakter lebar tidak bisa ditulis sendiri, mulai dari cell utamanya
+						if (x > 0 && after[x * 2 + 1] == 0) {
+							--x;
+						}
+
+						int end = x + 1;
+						while (true) {
+							while (end < width && (before[end * 2] != after[end * 2] || before[end * 2 + 1] != after[end * 2 + 1])) {
+								++end;
+							}
+
+							// Gabungkan perubahan yang berdekatan, lebih murah daripada pindah cursor lagi
+							int resume = Utility::Mismatch(before, after, end, width);
+							if (resume == width || resume - end >= 8) {
+								break;
+							}
+							end = resume + 1;
+						}
+
+						band.Spans.push_back({ y, x, end });
+						x = Utility::Mismatch(before, after, end, width);
+					}
+				}
+				});
+
+			// Style awal tiap band adalah pixel terakhir yang ditulis band sebelumnya
+			const Pixel* state = &reset;
+			for (Band& band : this->bands) {
+				band.Start = state;
+				if (!band.Spans.empty()) {
+					state = &next.Row(band.Spans.back().Y)[band.Spans.back().End - 1];
 				}
+			}
 
-				return false;
+			Utility::ThreadPool::Run(count, [&](int index) {
+				Band& band = this->bands[index];
+				const Pixel* prevPixel = band.Start;
+				band.Output.clear();
+
+				for (const Span& span : band.Spans) {
+					this->moveTo(band.Output, span.Y, span.X);
+					next.Encode(band.Output, span.Y, span.X, span.End, prevPixel);
+				}
+				});
+
+			for (const Band& band : this->bands) {
+				this->output += band.Output;
 			}
 
-			return false;
-		}
+			if (!this->output.empty()) {
+				this->output += "\x1b[m";
+			}
 
-	private:
-		int focusedComponent = 0;
-		std::vector<std::shared_ptr<Focusable>> components;
-	};
-	class HorizontalContainer final : public Base::Focusable {
-	public:
-		HorizontalContainer(std::vector<std::shared_ptr<Focusable>> components) :
-			components(std::move(components)) {
+			this->screenCells.swap(this->nextCells);
+			this->screenHashes.swap(this->nextHashes);
+			return this->output;
 		}
+		// Tulis frame langsung ke handle, dibungkus synchronized output dan diukur durasinya
+		auto Present(HANDLE handle, Buffer& next) -> void {
+			const std::string& frame = this->Present(next);
+			Clock::time_point begin = Clock::now();
+
+			if (!frame.empty()) {
+				bool synchronized = Capabilities::Current().Synchronized;
+				std::string& data = this->synchronizedOutput;
+				data.clear();
+				if (synchronized) {
+					data += "\x1b[?2026h";
+				}
+				data += frame;
+				if (synchronized) {
+					data += "\x1b[?2026l";
+				}
 
-		auto Focused(bool flag) -> void {
-			Focusable::Focused(flag);
+				DWORD written = 0;
+				WriteFile(handle, data.data(), static_cast<DWORD>(data.size()), &written, nullptr);
+			}
 
-			this->components[this->focusedComponent]->Focused(flag);
+			Clock::time_point end = Clock::now();
+			this->pace(end - begin);
+			this->lastFrame = end;
 		}
-		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
-			if (this->components[this->focusedComponent]->OnKey(keyEvent)) {
+		// Mode inline: hanya menguasai lines baris dibawah cursor, scrollback diatasnya tetap utuh. Boleh dipanggil
+		// lagi untuk mengubah tinggi region, region lama dihapus dari awalnya pada frame berikutnya
+		auto Inline(int lines) -> void {
+			if (this->inlineLines == 0) {
+				this->cursorY = 0;
+			}
+			this->inlineLines = lines;
+			this->screenHeight = 0;
+		}
+		auto Lines() -> const int& {
+			return this->inlineLines;
+		}
+		// Antrikan teks yang sudah selesai untuk ditulis diatas region pada frame berikutnya
+		auto Print(const std::string& text) -> void {
+			this->printed += text;
+		}
+		// Hapus region inline dan kembalikan cursor ke awal region, dipanggil saat program selesai
+		auto Close() -> const std::string& {
+			this->output.clear();
+			if (this->screenHeight > 0) {
+				this->clearRegion();
+			}
+			this->output += this->printed;
+			this->printed.clear();
+			this->screenHeight = 0;
+
+			return this->output;
+		}
+		// Waktu tunggu (ms) sebelum frame berikutnya boleh ditulis
+		auto Delay() -> DWORD {
+			Clock::duration elapsed = Clock::now() - this->lastFrame;
+			if (elapsed >= this->interval) {
+				return 0;
+			}
+
+			return static_cast<DWORD>(
+				std::chrono::duration_cast<std::chrono::milliseconds>(this->interval - elapsed).count() + 1
+				);
+		}
+		auto Interval() -> Clock::duration {
+			return this->interval;
+		}
+
+	public:
+		Clock::duration MinInterval = std::chrono::milliseconds(4);
+		Clock::duration MaxInterval = std::chrono::milliseconds(100);
+
+	private:
+		// Pixel dikemas menjadi dua word: style dan glyph, agar bisa dibandingkan dengan SIMD
+		static auto packPixel(const Pixel& pixel, uint64_t* cell) -> void {
+			cell[0] =
+				static_cast<uint64_t>(
+					pixel.Bold | pixel.Dim << 1 | pixel.Italic << 2 | pixel.Underline << 3 |
+					pixel.Blink << 4 | pixel.Invert << 5 | pixel.Invisible << 6 | pixel.Strikethrough << 7
+					) |
+				static_cast<uint64_t>(pixel.Foreground.Pack()) << 8 |
+				static_cast<uint64_t>(pixel.Background.Pack()) << 34;
+
+			// Glyph sampai 8 byte disimpan apa adanya, yang lebih panjang di-hash
+			cell[1] = 0;
+			if (pixel.Value.size() <= sizeof(uint64_t)) {
+				std::memcpy(&cell[1], pixel.Value.data(), pixel.Value.size());
+			}
+			else {
+				cell[1] = 14695981039346656037ull;
+				for (char ch : pixel.Value) {
+					cell[1] = (cell[1] ^ static_cast<unsigned char>(ch)) * 1099511628211ull;
+				}
+				cell[1] |= uint64_t(1) << 63;
+			}
+		}
+		static auto pack(Buffer& buf, std::vector<uint64_t>& cells) -> void {
+			size_t stride = static_cast<size_t>(buf.Width()) * 2;
+			cells.resize(buf.Height() * stride);
+
+			Utility::ThreadPool::Run(buf.Height(), [&](int y) {
+				const Pixel* row = buf.Row(y);
+				uint64_t* cell = cells.data() + y * stride;
+				for (int x = 0; x < buf.Width(); ++x) {
+					packPixel(row[x], cell + x * 2);
+				}
+				});
+		}
+		static auto hash(const uint64_t* cells, int height, int width, std::vector<uint64_t>& hashes) -> void {
+			size_t stride = static_cast<size_t>(width) * 2;
+			hashes.resize(height);
+
+			Utility::ThreadPool::Run(height, [&](int y) {
+				uint64_t value = 14695981039346656037ull;
+				for (size_t i = 0; i < stride; ++i) {
+					value = (value ^ cells[y * stride + i]) * 1099511628211ull;
+				}
+
+				hashes[y] = value;
+				});
+		}
+		static auto hash(const std::vector<uint64_t>& cells, int height, int width, std::vector<uint64_t>& hashes) -> void {
+			hash(cells.data(), height, width, hashes);
+		}
+		// Interval frame mengikuti rata-rata waktu tulis, terminal diberi jeda yang sama untuk memproses
+		auto pace(Clock::duration writeTime) -> void {
+			this->writeAverage = (this->writeAverage * 7 + writeTime) / 8;
+			this->interval = std::min(std::max(this->writeAverage * 2, this->MinInterval), this->MaxInterval);
+		}
+		auto moveUp(int lines) -> void {
+			if (lines > 0) {
+				char sequence[16] = "\x1b[";
+				char* end = std::to_chars(sequence + 2, sequence + 12, lines).ptr;
+				*end++ = 'A';
+				this->output.append(sequence, end);
+			}
+		}
+		auto clearRegion() -> void {
+			if (this->inlineLines > 0 && this->screenHeight > 0) {
+				this->moveUp(this->cursorY);
+				this->output += "\r\x1b[J";
+				this->cursorY = 0;
+			}
+		}
+		auto moveTo(std::string& out, int y, int x) -> void {
+			// Posisi absolut tidak diketahui pada mode inline, gunakan gerakan relatif
+			if (this->inlineLines > 0) {
+				char sequence[32] = "\x1b[";
+				char* end = sequence + 2;
+				if (y != this->cursorY) {
+					end = std::to_chars(end, end + 10, std::abs(y - this->cursorY)).ptr;
+					*end++ = y > this->cursorY ? 'B' : 'A';
+					*end++ = '\x1b';
+					*end++ = '[';
+				}
+				end = std::to_chars(end, end + 10, x + 1).ptr;
+				*end++ = 'G';
+				out.append(sequence, end);
+
+				this->cursorY = y;
+				return;
+			}
+
+			char sequence[24] = "\x1b[";
+			char* end = std::to_chars(sequence + 2, sequence + 12, y + 1).ptr;
+			if (x > 0) {
+				*end++ = ';';
+				end = std::to_chars(end, end + 10, x + 1).ptr;
+			}
+			*end++ = 'H';
+			out.append(sequence, end);
+		}
+		// Cari pergeseran vertikal terbaik lalu geser isi terminal dengan DECSTBM dan SU/SD
+		auto scroll() -> void {
+			int height = this->screenHeight;
+			int bestGain = 2;
+			int bestShift = 0;
+			int bestBegin = 0;
+			int bestEnd = 0;
+
+			for (int shift = -std::min(height / 2, 32); shift <= std::min(height / 2, 32); ++shift) {
+				if (shift == 0) {
+					continue;
+				}
+
+				// next[y] == screen[y + shift] berarti isi bergeser ke atas sebanyak shift
+				for (int y = std::max(0, -shift); y < std::min(height, height - shift); ) {
+					if (this->nextHashes[y] != this->screenHashes[y + shift]) {
+						++y;
+						continue;
+					}
+
+					int begin = y;
+					int gain = 0;
+					for (; y < std::min(height, height - shift) && this->nextHashes[y] == this->screenHashes[y + shift]; ++y) {
+						gain += this->nextHashes[y] != this->screenHashes[y];
+					}
+
+					if (gain > bestGain) {
+						bestGain = gain;
+						bestShift = shift;
+						bestBegin = begin;
+						bestEnd = y;
+					}
+				}
+			}
+
+			if (bestShift == 0) {
+				return;
+			}
+
+			// Region mencakup baris sumber dan baris tujuan
+			int top = std::min(bestBegin, bestBegin + bestShift);
+			int bottom = std::max(bestEnd, bestEnd + bestShift);
+			int count = std::abs(bestShift);
+
+			// Style terminal sudah direset di akhir frame sebelumnya, baris baru akan kosong
+			char sequence[48] = "\x1b[";
+			char* end = std::to_chars(sequence + 2, sequence + 12, top + 1).ptr;
+			*end++ = ';';
+			end = std::to_chars(end, end + 10, bottom).ptr;
+			*end++ = 'r';
+			*end++ = '\x1b';
+			*end++ = '[';
+			end = std::to_chars(end, end + 10, count).ptr;
+			*end++ = bestShift > 0 ? 'S' : 'T';
+			this->output.append(sequence, end);
+			this->output += "\x1b[r";
+
+			// Terapkan pergeseran yang sama pada salinan isi terminal
+			size_t stride = static_cast<size_t>(this->screenWidth) * 2;
+			auto first = this->screenCells.begin() + top * stride;
+			auto last = this->screenCells.begin() + bottom * stride;
+			if (bestShift > 0) {
+				std::move(first + count * stride, last, first);
+				std::move(this->screenHashes.begin() + top + count, this->screenHashes.begin() + bottom, this->screenHashes.begin() + top);
+			}
+			else {
+				std::move_backward(first, last - count * stride, last);
+				std::move_backward(this->screenHashes.begin() + top, this->screenHashes.begin() + bottom - count, this->screenHashes.begin() + bottom);
+			}
+
+			// Baris yang terbuka berisi pixel kosong
+			uint64_t blank[2];
+			packPixel(Pixel(), blank);
+			for (int i = 0; i < count; ++i) {
+				int y = bestShift > 0 ? bottom - 1 - i : top + i;
+				for (size_t x = 0; x < stride; x += 2) {
+					this->screenCells[y * stride + x] = blank[0];
+					this->screenCells[y * stride + x + 1] = blank[1];
+				}
+			}
+			int opened = bestShift > 0 ? bottom - 1 : top;
+			hash(this->screenCells.data() + opened * stride, 1, this->screenWidth, this->blankHash);
+			for (int i = 0; i < count; ++i) {
+				int y = bestShift > 0 ? bottom - 1 - i : top + i;
+				this->screenHashes[y] = this->blankHash[0];
+			}
+		}
+
+	private:
+		class Span final {
+		public:
+			int Y;
+			int X;
+			int End;
+		};
+		class Band final {
+		public:
+			const Pixel* Start = nullptr;
+			std::vector<Span> Spans;
+			std::string Output;
+		};
+
+		int screenHeight = 0;
+		int screenWidth = 0;
+		std::vector<uint64_t> screenCells;
+		std::vector<uint64_t> nextCells;
+		std::vector<uint64_t> blankHash;
+		std::vector<Band> bands;
+		int inlineLines = 0;
+		Buffer region = Buffer(0, 0);
+		int cursorY = 0;
+		std::string printed;
+		Clock::time_point lastFrame;
+		Clock::duration writeAverage = Clock::duration::zero();
+		Clock::duration interval = std::chrono::milliseconds(4);
+		std::string synchronizedOutput;
+		std::vector<uint64_t> screenHashes;
+		std::vector<uint64_t> nextHashes;
+		std::string output;
+	};
+
+	class TimerWheel final {
+	public:
+		using Clock = std::chrono::steady_clock;
+
+		// Id slot timer beserta generasinya, handle lama tidak lagi cocok setelah slot dipakai ulang timer lain
+		class Handle final {
+		public:
+			int Id = -1;
+			uint32_t Generation = 0;
+		};
+
+		TimerWheel() :
+			origin(Clock::now()),
+			event(CreateEventA(nullptr, FALSE, FALSE, nullptr)) {
+		}
+		TimerWheel(const TimerWheel&) = delete;
+		auto operator =(const TimerWheel&) -> TimerWheel& = delete;
+		~TimerWheel() {
+			if (this->event != nullptr) {
+				CloseHandle(this->event);
+			}
+		}
+
+		// Jadwalkan callback sekali setelah delay
+		auto Once(std::chrono::milliseconds delay, std::function<void()> callback) -> Handle {
+			return this->schedule(delay, std::chrono::milliseconds(0), std::move(callback));
+		}
+		// Jadwalkan callback berulang setiap interval
+		auto Every(std::chrono::milliseconds interval, std::function<void()> callback) -> Handle {
+			return this->schedule(interval, std::max(interval, std::chrono::milliseconds(1)), std::move(callback));
+		}
+		auto Cancel(Handle handle) -> void {
+			int id = handle.Id;
+			if (id < 0 || id >= static_cast<int>(this->timers.size()) || !this->timers[id].active ||
+				this->timers[id].generation != handle.Generation) {
+				return;
+			}
+
+			this->unlink(id);
+			this->release(id);
+		}
+		// Bangunkan event loop, aman dipanggil dari thread mana saja. Dipakai widget yang hasil kerja
+		// background-nya harus digambar walaupun tidak ada input maupun timer
+		auto Wake() -> void {
+			this->woken.store(true, std::memory_order_release);
+			SetEvent(this->event);
+		}
+		// Event auto-reset yang ditunggu event loop bersama handle input, misalnya dengan WaitForMultipleObjects
+		auto Event() const -> HANDLE {
+			return this->event;
+		}
+		// Jalankan semua timer yang sudah jatuh tempo, true jika ada yang dijalankan atau Wake dipanggil
+		auto Advance() -> bool {
+			uint64_t target = this->tick();
+			bool fired = this->woken.exchange(false, std::memory_order_acq_rel);
+
+			while (true) {
+				uint64_t next;
+				if (!this->nextExpiry(next) || next > target) {
+					this->jump(std::max(target, this->now));
+					break;
+				}
+
+				this->jump(next);
+				fired = this->fire() || fired;
+			}
+
+			return fired;
+		}
+		// Waktu tunggu (ms) sampai deadline berikutnya, cocok untuk WaitForMultipleObjects
+		auto Timeout() -> DWORD {
+			uint64_t next;
+			if (!this->nextExpiry(next)) {
+				return INFINITE;
+			}
+
+			uint64_t current = this->tick();
+			if (next <= current) {
+				return 0;
+			}
+
+			return static_cast<DWORD>(std::min<uint64_t>(next - current, INFINITE - 1));
+		}
+		auto Empty() -> bool {
+			return this->timers.size() == this->freeIds.size();
+		}
+
+		// Wheel milik event loop yang dipakai widget untuk menjadwalkan callback, nullptr berarti tidak ada
+		static auto Current() -> TimerWheel*& {
+			static TimerWheel* current = nullptr;
+			return current;
+		}
+
+	private:
+		static constexpr int Bits = 6;
+		static constexpr int Slots = 1 << Bits;
+		static constexpr int Levels = (64 + Bits - 1) / Bits;
+
+		class Timer final {
+		public:
+			uint64_t expiry = 0;
+			uint64_t interval = 0;
+			int level = -1;
+			int slot = -1;
+			uint32_t generation = 0;
+			bool active = false;
+			std::function<void()> callback;
+		};
+
+		auto tick() -> uint64_t {
+			return static_cast<uint64_t>(
+				std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - this->origin).count()
+				);
+		}
+		auto schedule(std::chrono::milliseconds delay, std::chrono::milliseconds interval, std::function<void()> callback) -> Handle {
+			uint64_t current = this->tick();
+
+			// Wheel kosong, posisi now bisa langsung disamakan dengan waktu sekarang
+			if (this->Empty()) {
+				this->now = std::max(this->now, current);
+			}
+
+			int id;
+			if (this->freeIds.empty()) {
+				id = static_cast<int>(this->timers.size());
+				this->timers.emplace_back();
+			}
+			else {
+				id = this->freeIds.back();
+				this->freeIds.pop_back();
+			}
+
+			Timer& timer = this->timers[id];
+			timer.expiry = current + static_cast<uint64_t>(std::max<long long>(delay.count(), 0));
+			timer.interval = static_cast<uint64_t>(interval.count());
+			timer.active = true;
+			timer.callback = std::move(callback);
+			this->link(id);
+
+			return Handle{ id, timer.generation };
+		}
+		auto release(int id) -> void {
+			Timer& timer = this->timers[id];
+			++timer.generation;
+			timer.active = false;
+			timer.level = -1;
+			timer.slot = -1;
+			timer.callback = nullptr;
+			this->freeIds.push_back(id);
+		}
+		// Letakkan timer pada level tertinggi dimana digit expiry berbeda dengan now
+		auto link(int id) -> void {
+			Timer& timer = this->timers[id];
+			timer.expiry = std::max(timer.expiry, this->now);
+
+			uint64_t expiry = timer.expiry;
+			uint64_t diff = expiry ^ this->now;
+
+			int level = 0;
+			while (level < Levels - 1 && (diff >> ((level + 1) * Bits)) != 0) {
+				++level;
+			}
+
+			timer.level = level;
+			timer.slot = static_cast<int>((expiry >> (level * Bits)) & (Slots - 1));
+			this->slots[level][timer.slot].push_back(id);
+			this->occupied[level] |= uint64_t(1) << timer.slot;
+		}
+		auto unlink(int id) -> void {
+			Timer& timer = this->timers[id];
+			if (timer.level < 0) {
+				return;
+			}
+
+			std::vector<int>& slot = this->slots[timer.level][timer.slot];
+			auto it = std::find(slot.begin(), slot.end(), id);
+			if (it != slot.end()) {
+				*it = slot.back();
+				slot.pop_back();
+			}
+			if (slot.empty()) {
+				this->occupied[timer.level] &= ~(uint64_t(1) << timer.slot);
+			}
+
+			timer.level = -1;
+			timer.slot = -1;
+		}
+		// Cari expiry paling awal tanpa memajukan wheel
+		auto nextExpiry(uint64_t& result) -> bool {
+			for (int level = 0; level < Levels; ++level) {
+				if (this->occupied[level] == 0) {
+					continue;
+				}
+
+				// Slot pada level ini selalu berada di depan digit now, slot terdekat adalah yang paling awal
+				int digit = static_cast<int>((this->now >> (level * Bits)) & (Slots - 1));
+				uint64_t mask = this->occupied[level] & (~uint64_t(0) << digit);
+				int slot = lowestBit(mask != 0 ? mask : this->occupied[level]);
+
+				result = std::numeric_limits<uint64_t>::max();
+				for (int id : this->slots[level][slot]) {
+					result = std::min(result, this->timers[id].expiry);
+				}
+
 				return true;
 			}
 
-			if (
-				((keyEvent.dwControlKeyState & SHIFT_PRESSED) && keyEvent.wVirtualKeyCode == VK_TAB) ||
-				keyEvent.wVirtualKeyCode == VK_LEFT ||
-				keyEvent.uChar.AsciiChar == 'h' ||
-				keyEvent.uChar.AsciiChar == 'H'
-				) {
-				if (this->focusedComponent > 0) {
-					this->components[this->focusedComponent]->Focused(false);
-					this->components[--this->focusedComponent]->Focused(true);
-					return true;
+			return false;
+		}
+		// Majukan now, lalu turunkan (cascade) slot yang kini menjadi jendela aktif
+		auto jump(uint64_t target) -> void {
+			this->now = target;
+
+			for (int level = Levels - 1; level > 0; --level) {
+				int digit = static_cast<int>((this->now >> (level * Bits)) & (Slots - 1));
+				if ((this->occupied[level] & (uint64_t(1) << digit)) == 0) {
+					continue;
+				}
+
+				std::vector<int> cascade;
+				cascade.swap(this->slots[level][digit]);
+				this->occupied[level] &= ~(uint64_t(1) << digit);
+
+				for (int id : cascade) {
+					this->timers[id].level = -1;
+					this->link(id);
+				}
+			}
+		}
+		auto fire() -> bool {
+			int digit = static_cast<int>(this->now & (Slots - 1));
+			if ((this->occupied[0] & (uint64_t(1) << digit)) == 0) {
+				return false;
+			}
+
+			std::vector<int> due;
+			due.swap(this->slots[0][digit]);
+			this->occupied[0] &= ~(uint64_t(1) << digit);
+			for (int id : due) {
+				this->timers[id].level = -1;
+			}
+
+			for (int id : due) {
+				// Timer bisa dibatalkan oleh callback sebelumnya
+				if (!this->timers[id].active || this->timers[id].level >= 0) {
+					continue;
+				}
+
+				std::function<void()> callback = this->timers[id].callback;
+				if (this->timers[id].interval > 0) {
+					// Periode yang terlewat (misalnya setelah stall atau suspend) dilewati, bukan dikejar beruntun
+					uint64_t expiry = this->now + this->timers[id].interval;
+					uint64_t current = this->tick();
+					this->timers[id].expiry = expiry > current ? expiry : current + this->timers[id].interval;
+					this->link(id);
+				}
+				else {
+					this->release(id);
+				}
+
+				callback();
+			}
+
+			return true;
+		}
+		static auto lowestBit(uint64_t value) -> int {
+			int index = 0;
+			while ((value & 1) == 0) {
+				value >>= 1;
+				++index;
+			}
+			return index;
+		}
+
+	private:
+		Clock::time_point origin;
+		uint64_t now = 0;
+		uint64_t occupied[Levels] = {};
+		std::vector<int> slots[Levels][Slots];
+		std::vector<Timer> timers;
+		std::vector<int> freeIds;
+		HANDLE event;
+		std::atomic<bool> woken{ false };
+	};
+
+	class SampleRing final {
+	public:
+		SampleRing(int capacity) :
+			capacity(std::max(capacity, 1)),
+			samples(new std::atomic<double>[std::max(capacity, 1)]) {
+		}
+
+		// Aman dipanggil dari thread worker, tanpa lock dan tanpa alokasi
+		auto Push(double value) -> void {
+			uint64_t index = this->head.fetch_add(1, std::memory_order_relaxed);
+			this->samples[index % this->capacity].store(value, std::memory_order_relaxed);
+			this->count.fetch_add(1, std::memory_order_release);
+		}
+		// Salin sample terbaru (urut dari yang terlama) ke output, dipanggil sekali per frame
+		auto Snapshot(std::vector<double>& output) const -> void {
+			uint64_t written = this->count.load(std::memory_order_acquire);
+			uint64_t size = std::min<uint64_t>(written, this->capacity);
+
+			output.resize(static_cast<size_t>(size));
+			for (uint64_t i = 0; i < size; ++i) {
+				output[static_cast<size_t>(i)] = this->samples[(written - size + i) % this->capacity].load(std::memory_order_relaxed);
+			}
+		}
+		auto Capacity() const -> int {
+			return static_cast<int>(this->capacity);
+		}
+
+	private:
+		uint64_t capacity;
+		std::unique_ptr<std::atomic<double>[]> samples;
+		std::atomic<uint64_t> head = 0;
+		std::atomic<uint64_t> count = 0;
+	};
+
+	class SelectableGroup;
+	// Rentang byte dalam satu baris beserta style highlight-nya
+	class Token final {
+	public:
+		auto Apply(Pixel& pixel) const -> void {
+			if (!this->Foreground.IsDefault()) {
+				pixel.Foreground = this->Foreground;
+			}
+			pixel.Bold |= this->Bold;
+			pixel.Italic |= this->Italic;
+			pixel.Underline |= this->Underline;
+		}
+
+	public:
+		uint32_t Begin = 0;
+		uint32_t End = 0;
+		Color Foreground = Palette16::Default;
+		bool Bold = false;
+		bool Italic = false;
+		bool Underline = false;
+	};
+	namespace Base {
+		class Renderable {
+		public:
+			virtual auto Init() -> void {}
+			virtual auto Set(Rectangle dimension) -> void {
+				this->Dimension = dimension;
+				this->Dirty = false;
+			}
+			virtual auto Render(Buffer&) -> void {}
+
+			// Init lalu tandai Dirty jika ukuran atau constraint node berubah sejak Init sebelumnya
+			auto Measure() -> bool {
+				auto before = this->constraints();
+
+				this->Init();
+				if (this->constraints() != before) {
+					this->Dirty = true;
+				}
+
+				return this->Dirty;
+			}
+			// Set hanya jika constraint berubah atau subtree perlu layout ulang
+			auto Place(Rectangle dimension) -> void {
+				if (this->Dirty || this->Dimension != dimension) {
+					this->Set(dimension);
+				}
+			}
+			// Diminta node yang baru tahu ukurannya saat Set, misalnya Paragraph yang tingginya bergantung pada lebar.
+			// Event loop cukup Measure dan Place sekali lagi pada frame yang memintanya
+			static auto Relayout() -> bool& {
+				static bool relayout = false;
+				return relayout;
+			}
+			// Salin bobot flex dan batas ukuran dari node lain, dipakai modifier yang meneruskan constraint anak
+			auto Inherit(const Renderable& element) -> void {
+				this->FlexY = element.FlexY;
+				this->FlexX = element.FlexX;
+				this->ShrinkY = element.ShrinkY;
+				this->ShrinkX = element.ShrinkX;
+				this->MinHeight = element.MinHeight;
+				this->MaxHeight = element.MaxHeight;
+				this->MinWidth = element.MinWidth;
+				this->MaxWidth = element.MaxWidth;
+			}
+
+		private:
+			auto constraints() const -> std::tuple<int, int, int, int, int, int, int, int, int, int> {
+				return std::make_tuple(
+					this->Height, this->Width,
+					this->FlexY, this->FlexX,
+					this->ShrinkY, this->ShrinkX,
+					this->MinHeight, this->MaxHeight,
+					this->MinWidth, this->MaxWidth
+				);
+			}
+
+		public:
+			int Height = 0;
+			int Width = 0;
+			// Bobot pembagian sisa ruang (FlexY/FlexX) dan kekurangan ruang (ShrinkY/ShrinkX)
+			int FlexY = 0;
+			int FlexX = 0;
+			int ShrinkY = 0;
+			int ShrinkX = 0;
+			int MinHeight = 0;
+			int MaxHeight = std::numeric_limits<int>::max();
+			int MinWidth = 0;
+			int MaxWidth = std::numeric_limits<int>::max();
+			bool Dirty = true;
+			Rectangle Dimension;
+		};
+		class Focusable {
+		public:
+			auto Focused() -> const bool& {
+				return this->focused;
+			}
+			virtual auto Focused(bool flag) -> void {
+				this->focused = flag;
+			}
+			virtual auto OnKey(const KEY_EVENT_RECORD&) -> bool {
+				return false;
+			}
+
+		private:
+			bool focused = false;
+		};
+		class Selectable {
+		public:
+			Selectable() = default;
+			Selectable(std::string name) :
+				name(std::move(name)),
+				nameColumns(Unicode::Columns(this->name)) {
+			}
+			auto Selected() -> const bool& {
+				return this->selected;
+			}
+			virtual auto Selected(bool flag) -> void {
+				this->selected = flag;
+			}
+			auto SetGroup(SelectableGroup* group) -> void {
+				this->group = group;
+			}
+			auto Name() -> const std::string& {
+				return this->name;
+			}
+
+		protected:
+			std::string name;
+			int nameColumns = 0;
+			SelectableGroup* group = nullptr;
+
+		private:
+			bool selected = false;
+		};
+		class Modifier : public Renderable {
+		public:
+			Modifier(std::shared_ptr<Renderable> element) :
+				element(std::move(element)) {
+			}
+
+			virtual auto Init() -> void override {
+				if (this->element->Measure()) {
+					Renderable::Dirty = true;
+				}
+				Renderable::Height = this->element->Height;
+				Renderable::Width = this->element->Width;
+			}
+			virtual auto Set(Rectangle dimension) -> void override {
+				this->element->Place(dimension);
+				Renderable::Set(dimension);
+			}
+			virtual auto Render(Buffer& buf) -> void override {
+				this->element->Render(buf);
+			}
+
+		protected:
+			std::shared_ptr<Renderable> element;
+		};
+		// Lexer per baris. State awal baris (misalnya di dalam komentar blok) diberikan oleh pemanggil dan
+		// state akhir baris dikembalikan, sehingga editor bisa melanjutkan dari baris mana saja
+		class Tokenizer {
+		public:
+			virtual ~Tokenizer() = default;
+			virtual auto Tokenize(std::string_view line, int state, std::vector<Token>& tokens) -> int = 0;
+		};
+		// Sumber anak untuk TreeView, dipanggil sekali saat node pertama kali dibuka. Pada TreeView async
+		// Children dipanggil dari thread loader sehingga tidak boleh menyentuh widget
+		class TreeProvider {
+		public:
+			class Item final {
+			public:
+				std::string Label;
+				uint64_t Key = 0;
+				bool Leaf = false;
+			};
+
+			virtual ~TreeProvider() = default;
+			virtual auto Children(uint64_t key, std::vector<Item>& items) -> void = 0;
+		};
+	}
+	namespace Utility {
+		template<class Type, class... Args>
+		std::vector<Type> ToVector(Args&&... args) {
+			return std::vector<Type>{ std::forward<Args>(args)... };
+		}
+
+		// Bump allocator, semua memori dilepas sekaligus saat arena dihancurkan
+		class Arena final {
+		public:
+			Arena(size_t blockSize = 64 * 1024) :
+				blockSize(blockSize) {
+			}
+			Arena(const Arena&) = delete;
+			auto operator =(const Arena&) -> Arena& = delete;
+
+			auto Allocate(size_t size, size_t alignment) -> void* {
+				void* result = this->cursor;
+				size_t space = static_cast<size_t>(this->limit - this->cursor);
+
+				if (this->cursor == nullptr || std::align(alignment, size, result, space) == nullptr) {
+					// Alokasi besar mendapat block sendiri agar block aktif tidak terbuang
+					size_t capacity = std::max(this->blockSize, size + alignment);
+					this->blocks.emplace_back(new char[capacity]);
+
+					result = this->blocks.back().get();
+					space = capacity;
+					std::align(alignment, size, result, space);
+
+					if (capacity > this->blockSize) {
+						return result;
+					}
+				}
+
+				this->cursor = static_cast<char*>(result) + size;
+				this->limit = this->cursor + (space - size);
+				return result;
+			}
+			auto Blocks() -> size_t {
+				return this->blocks.size();
+			}
+
+		private:
+			size_t blockSize;
+			char* cursor = nullptr;
+			char* limit = nullptr;
+			std::vector<std::unique_ptr<char[]>> blocks;
+		};
+		template<class Type>
+		class ArenaAllocator final {
+		public:
+			using value_type = Type;
+
+			ArenaAllocator(Arena& arena) :
+				arena(&arena) {
+			}
+			template<class Other>
+			ArenaAllocator(const ArenaAllocator<Other>& other) :
+				arena(other.arena) {
+			}
+
+			auto allocate(size_t count) -> Type* {
+				return static_cast<Type*>(this->arena->Allocate(count * sizeof(Type), alignof(Type)));
+			}
+			auto deallocate(Type*, size_t) -> void {}
+
+			template<class Other>
+			auto operator ==(const ArenaAllocator<Other>& other) const -> bool {
+				return this->arena == other.arena;
+			}
+			template<class Other>
+			auto operator !=(const ArenaAllocator<Other>& other) const -> bool {
+				return this->arena != other.arena;
+			}
+
+		public:
+			Arena* arena;
+		};
+		// Selama scope ini hidup, semua factory mengalokasikan node dari arena
+		class ArenaScope final {
+		public:
+			ArenaScope(Arena& arena) :
+				previous(Current()) {
+				Current() = &arena;
+			}
+			~ArenaScope() {
+				Current() = this->previous;
+			}
+			ArenaScope(const ArenaScope&) = delete;
+			auto operator =(const ArenaScope&) -> ArenaScope& = delete;
+
+			static auto Current() -> Arena*& {
+				static thread_local Arena* current = nullptr;
+				return current;
+			}
+
+		private:
+			Arena* previous;
+		};
+		// Root tree beserta arena tempat node-nya dialokasikan, keduanya selalu dihancurkan bersama. Arena hanya aktif
+		// selama Build, node yang dibuat kemudian (misalnya saat event) memakai heap biasa. Pointer ke node tree lama
+		// tidak boleh disimpan di luar root karena arenanya dilepas saat Build berikutnya
+		template<class Type>
+		class ArenaTree final {
+		public:
+			ArenaTree() = default;
+			ArenaTree(const ArenaTree&) = delete;
+			auto operator =(const ArenaTree&) -> ArenaTree& = delete;
+
+			// Hancurkan tree lama lalu arenanya, kemudian bangun root baru dari builder di dalam arena baru
+			template<class Builder>
+			auto Build(Builder&& builder) -> Type& {
+				this->root = Type();
+				this->arena.reset(new Arena());
+
+				ArenaScope scope(*this->arena);
+				this->root = builder();
+				return this->root;
+			}
+			auto Root() -> Type& {
+				return this->root;
+			}
+			auto Blocks() -> size_t {
+				return this->arena ? this->arena->Blocks() : 0;
+			}
+
+		private:
+			// Urutan member menjamin root dihancurkan sebelum arena
+			std::unique_ptr<Arena> arena;
+			Type root;
+		};
+		inline auto Clamp(int size, int min, int max) -> int {
+			return std::max(min, std::min(size, max));
+		}
+
+		// Satu anak pada sumbu utama layout
+		class FlexItem final {
+		public:
+			static auto Column(const Base::Renderable& element) -> FlexItem {
+				return { element.Height, element.MinHeight, element.MaxHeight, element.FlexY, element.ShrinkY };
+			}
+			static auto Row(const Base::Renderable& element) -> FlexItem {
+				return { element.Width, element.MinWidth, element.MaxWidth, element.FlexX, element.ShrinkX };
+			}
+
+		public:
+			int Base = 0;
+			int Min = 0;
+			int Max = std::numeric_limits<int>::max();
+			int Grow = 0;
+			int Shrink = 0;
+			int Size = 0;
+		};
+
+		// Bagi ruang sepanjang sumbu utama: ukuran dasar di-clamp ke min/max, lalu sisa atau kekurangan ruang
+		// dibagi menurut bobot Grow atau Shrink. Anak diurutkan menurut ruang sampai batasnya per bobot, sehingga
+		// semua anak yang bagiannya melewati batas dibekukan dalam satu lintasan. Sisanya dibagi dengan batas kumulatif
+		// sesuai urutan anak sehingga sisa pembulatan tidak hilang
+		inline auto Flex(FlexItem* items, int count, int space) -> void {
+			int64_t used = 0;
+			for (int i = 0; i < count; ++i) {
+				items[i].Size = Clamp(items[i].Base, items[i].Min, items[i].Max);
+				used += items[i].Size;
+			}
+			if (used == space) {
+				return;
+			}
+
+			bool grow = used < space;
+			auto weight = [grow](const FlexItem& item) -> int64_t {
+				return grow ? item.Grow : item.Shrink;
+			};
+			// Ruang yang masih bisa ditambah atau dilepas sebelum anak menyentuh Max atau Min
+			auto room = [grow](const FlexItem& item) -> int64_t {
+				return grow ? static_cast<int64_t>(item.Max) - item.Size : static_cast<int64_t>(item.Size) - item.Min;
+			};
+
+			std::vector<int> order;
+			int64_t total = 0;
+			for (int i = 0; i < count; ++i) {
+				if (weight(items[i]) > 0) {
+					order.push_back(i);
+					total += weight(items[i]);
+				}
+			}
+			std::sort(order.begin(), order.end(), [&](int a, int b) {
+				return room(items[a]) * weight(items[b]) < room(items[b]) * weight(items[a]);
+				});
+
+			// Selama bagian proporsional anak dengan rasio terkecil tidak muat, anak itu dibekukan di batasnya.
+			// Rasio ruang per bobot yang tersisa hanya bisa naik, jadi anak pertama yang muat mengakhiri pembekuan
+			int64_t free = grow ? space - used : used - space;
+			size_t first = 0;
+			for (; first < order.size() && free > 0; ++first) {
+				FlexItem& item = items[order[first]];
+				if (room(item) * total > free * weight(item)) {
+					break;
+				}
+
+				free -= room(item);
+				total -= weight(item);
+				item.Size = grow ? item.Max : item.Min;
+			}
+			if (total == 0 || free <= 0) {
+				return;
+			}
+
+			std::sort(order.begin() + first, order.end());
+			int64_t cumulative = 0;
+			for (size_t k = first; k < order.size(); ++k) {
+				FlexItem& item = items[order[k]];
+				int64_t before = free * cumulative / total;
+				cumulative += weight(item);
+				int64_t share = free * cumulative / total - before;
+				item.Size += static_cast<int>(grow ? share : -share);
+			}
+		}
+		// Ukuran pada sumbu silang: anak dengan flex mengisi ruang, lainnya memakai ukuran yang diukur
+		inline auto Cross(int size, int min, int max, int flex, int space) -> int {
+			return Clamp(flex > 0 ? space : size, min, max);
+		}
+
+		// Render anak secara paralel jika area mereka tidak saling tumpang tindih. Container menghitung disjoint
+		// saat Set dari cara ia menyusun anak, sehingga tidak ada perbandingan antar anak setiap frame
+		inline auto RenderAll(const std::vector<std::shared_ptr<Base::Renderable>>& elements, Buffer& buf, bool disjoint) -> void {
+			ThreadPool* pool = ThreadPool::Current();
+			int area = 0;
+			if (pool != nullptr && disjoint && elements.size() > 1) {
+				for (const auto& element : elements) {
+					const Rectangle& a = element->Dimension;
+					area += std::max(a.Right - a.Left, 0) * std::max(a.Bottom - a.Top, 0);
+				}
+			}
+
+			if (area < 4096) {
+				for (const auto& element : elements) {
+					element->Render(buf);
+				}
+				return;
+			}
+
+			pool->For(static_cast<int>(elements.size()), [&](int i) { elements[i]->Render(buf); });
+		}
+		template<class Type, class... Args>
+		auto Make(Args&&... args) -> std::shared_ptr<Type> {
+			if (Arena* arena = ArenaScope::Current()) {
+				return std::allocate_shared<Type>(ArenaAllocator<Type>(*arena), std::forward<Args>(args)...);
+			}
+
+			return std::make_shared<Type>(std::forward<Args>(args)...);
+		}
+	}
+
+	class SelectableGroup final {
+	public:
+		SelectableGroup(std::vector<std::shared_ptr<Base::Selectable>> components) {
+			for (auto& component : components) {
+				component->SetGroup(this);
+				this->components.push_back(std::move(component));
+			}
+		}
+		// Anggota menyimpan pointer ke group, sehingga group tidak boleh disalin atau dipindah
+		SelectableGroup(const SelectableGroup&) = delete;
+		auto operator =(const SelectableGroup&) -> SelectableGroup& = delete;
+		void Clear() {
+			for (const auto& component : this->components) {
+				component->Selected(false);
+			}
+		}
+		auto Selected() -> const std::shared_ptr<Base::Selectable>& {
+			for (const auto& component : this->components) {
+				if (component->Selected()) {
+					return component;
+				}
+			}
+		}
+
+	private:
+		std::vector<std::shared_ptr<Base::Selectable>> components;
+	};
+
+	class VerticalLayout final : public Base::Renderable {
+	public:
+		VerticalLayout(std::vector<std::shared_ptr<Renderable>> elements) :
+			elements(std::move(elements)) {
+		}
+
+		auto Init() -> void override {
+			Renderable::Height = 0;
+			Renderable::Width = 0;
+			Renderable::FlexX = 0;
+			Renderable::FlexY = 0;
+
+			Renderable::ShrinkX = 0;
+			Renderable::ShrinkY = 0;
+
+			for (const auto& element : this->elements) {
+				if (element->Measure()) {
+					Renderable::Dirty = true;
+				}
+
+				Renderable::Height += Utility::Clamp(element->Height, element->MinHeight, element->MaxHeight);
+				Renderable::Width = std::max(Renderable::Width, Utility::Clamp(element->Width, element->MinWidth, element->MaxWidth));
+				Renderable::FlexX += element->FlexX;
+				Renderable::FlexY += element->FlexY;
+				Renderable::ShrinkX += element->ShrinkX;
+				Renderable::ShrinkY += element->ShrinkY;
+			}
+			if (!this->elements.empty()) {
+				Renderable::Height += this->Gap * static_cast<int>(this->elements.size() - 1);
+			}
+		}
+		auto Set(Rectangle dimension) -> void override {
+			Renderable::Set(dimension);
+
+			int count = static_cast<int>(this->elements.size());
+			this->items.resize(count);
+			for (int i = 0; i < count; ++i) {
+				this->items[i] = Utility::FlexItem::Column(*this->elements[i]);
+			}
+			Utility::Flex(this->items.data(), count, dimension.Bottom - dimension.Top - this->Gap * std::max(count - 1, 0));
+
+			for (int i = 0; i < count; ++i) {
+				const auto& element = this->elements[i];
+				int width = Utility::Cross(element->Width, element->MinWidth, element->MaxWidth, element->FlexX, Renderable::Dimension.Right - Renderable::Dimension.Left);
+
+				dimension.Right = dimension.Left + width;
+				dimension.Bottom = dimension.Top + this->items[i].Size;
+				element->Place(dimension);
+
+				dimension.Top = dimension.Bottom + this->Gap;
+			}
+		}
+		auto Render(Buffer& buf) -> void override {
+			// Anak disusun berurutan tanpa celah negatif sehingga tidak pernah tumpang tindih
+			Utility::RenderAll(this->elements, buf, this->Gap >= 0);
+		}
+
+	public:
+		// Jarak antar anak, diatur langsung pada node yang dikembalikan factory (misalnya VLayout(...)->Gap = 1)
+		int Gap = 0;
+
+	private:
+		std::vector<std::shared_ptr<Renderable>> elements;
+		std::vector<Utility::FlexItem> items;
+	};
+	class HorizontalLayout final : public Base::Renderable {
+	public:
+		HorizontalLayout(std::vector<std::shared_ptr<Renderable>> elements) :
+			elements(std::move(elements)) {
+		}
+
+		auto Init() -> void override {
+			Renderable::Height = 0;
+			Renderable::Width = 0;
+			Renderable::FlexX = 0;
+			Renderable::FlexY = 0;
+
+			Renderable::ShrinkX = 0;
+			Renderable::ShrinkY = 0;
+
+			for (const auto& element : this->elements) {
+				if (element->Measure()) {
+					Renderable::Dirty = true;
+				}
+
+				Renderable::Height = std::max(Renderable::Height, Utility::Clamp(element->Height, element->MinHeight, element->MaxHeight));
+				Renderable::Width += Utility::Clamp(element->Width, element->MinWidth, element->MaxWidth);
+				Renderable::FlexX += element->FlexX;
+				Renderable::FlexY += element->FlexY;
+				Renderable::ShrinkX += element->ShrinkX;
+				Renderable::ShrinkY += element->ShrinkY;
+			}
+			if (!this->elements.empty()) {
+				Renderable::Width += this->Gap * static_cast<int>(this->elements.size() - 1);
+			}
+		}
+		auto Set(Rectangle dimension) -> void override {
+			Renderable::Set(dimension);
+
+			int count = static_cast<int>(this->elements.size());
+			this->items.resize(count);
+			for (int i = 0; i < count; ++i) {
+				this->items[i] = Utility::FlexItem::Row(*this->elements[i]);
+			}
+			Utility::Flex(this->items.data(), count, dimension.Right - dimension.Left - this->Gap * std::max(count - 1, 0));
+
+			for (int i = 0; i < count; ++i) {
+				const auto& element = this->elements[i];
+				int height = Utility::Cross(element->Height, element->MinHeight, element->MaxHeight, element->FlexY, Renderable::Dimension.Bottom - Renderable::Dimension.Top);
+
+				dimension.Right = dimension.Left + this->items[i].Size;
+				dimension.Bottom = dimension.Top + height;
+				element->Place(dimension);
+
+				dimension.Left = dimension.Right + this->Gap;
+			}
+		}
+		auto Render(Buffer& buf) -> void override {
+			// Anak disusun berurutan tanpa celah negatif sehingga tidak pernah tumpang tindih
+			Utility::RenderAll(this->elements, buf, this->Gap >= 0);
+		}
+
+	public:
+		// Jarak antar anak, diatur langsung pada node yang dikembalikan factory (misalnya VLayout(...)->Gap = 1)
+		int Gap = 0;
+
+	private:
+		std::vector<std::shared_ptr<Renderable>> elements;
+		std::vector<Utility::FlexItem> items;
+	};
+	// Ukuran satu baris atau kolom Grid: tetap, mengikuti isi, atau bagian dari sisa ruang
+	class Track final {
+	public:
+		enum class Type : int {
+			Fixed,
+			Auto,
+			Fraction
+		};
+
+		static auto Fixed(int size) -> Track {
+			return { Type::Fixed, size };
+		}
+		static auto Auto() -> Track {
+			return { Type::Auto, 0 };
+		}
+		static auto Fraction(int weight = 1) -> Track {
+			return { Type::Fraction, weight };
+		}
+
+	public:
+		Type Kind = Type::Auto;
+		int Value = 0;
+	};
+	class Grid final : public Base::Renderable {
+	public:
+		enum class Align : int {
+			Start,
+			Center,
+			End,
+			Stretch
+		};
+
+		Grid(std::vector<Track> columns, std::vector<Track> rows = {}) {
+			this->columns.Tracks = std::move(columns);
+			this->rows.Tracks = std::move(rows);
+		}
+
+		// Tempatkan element pada sel (row, column), baris atau kolom yang belum ada ditambahkan sebagai Auto.
+		// Secara default element memakai ukuran yang diukurnya, Stretch membuatnya mengisi seluruh sel
+		auto Add(std::shared_ptr<Renderable> element, int row, int column, int rowSpan = 1, int columnSpan = 1, Align alignY = Align::Start, Align alignX = Align::Start) -> Grid& {
+			if (static_cast<int>(this->rows.Tracks.size()) < row + rowSpan) {
+				this->rows.Tracks.resize(row + rowSpan, Track::Auto());
+			}
+			if (static_cast<int>(this->columns.Tracks.size()) < column + columnSpan) {
+				this->columns.Tracks.resize(column + columnSpan, Track::Auto());
+			}
+
+			this->cells.push_back({ row, column, std::max(rowSpan, 1), std::max(columnSpan, 1), alignY, alignX });
+			this->elements.push_back(std::move(element));
+			this->measured = false;
+			Renderable::Dirty = true;
+			return *this;
+		}
+
+		auto Init() -> void override {
+			bool stale = !this->measured || this->measuredGapY != this->GapY || this->measuredGapX != this->GapX;
+			for (const auto& element : this->elements) {
+				if (element->Measure()) {
+					Renderable::Dirty = true;
+					stale = true;
+				}
+			}
+
+			// Ukuran isi track hanya dihitung ulang saat sel bertambah, gap berubah, atau ada anak yang Dirty
+			// setelah Measure. Selain itu ukuran dari frame sebelumnya dipakai lagi, Set cukup membagi sisa ruang
+			if (stale) {
+				this->rows.Measure(this->cells, this->elements, this->GapY, &Cell::Row, &Cell::RowSpan, &Renderable::Height);
+				this->columns.Measure(this->cells, this->elements, this->GapX, &Cell::Column, &Cell::ColumnSpan, &Renderable::Width);
+				this->measured = true;
+				this->measuredGapY = this->GapY;
+				this->measuredGapX = this->GapX;
+			}
+
+			Renderable::Height = this->rows.Total;
+			Renderable::Width = this->columns.Total;
+			Renderable::FlexY = this->rows.Weight > 0 ? 1 : 0;
+			Renderable::FlexX = this->columns.Weight > 0 ? 1 : 0;
+		}
+		auto Set(Rectangle dimension) -> void override {
+			Renderable::Set(dimension);
+
+			this->rows.Arrange(dimension.Top, dimension.Bottom - dimension.Top, this->GapY);
+			this->columns.Arrange(dimension.Left, dimension.Right - dimension.Left, this->GapX);
+
+			for (size_t i = 0; i < this->cells.size(); ++i) {
+				const Cell& cell = this->cells[i];
+				const auto& element = this->elements[i];
+
+				int top = this->rows.Offsets[cell.Row];
+				int bottom = this->rows.Offsets[cell.Row + cell.RowSpan - 1] + this->rows.Items[cell.Row + cell.RowSpan - 1].Size;
+				int left = this->columns.Offsets[cell.Column];
+				int right = this->columns.Offsets[cell.Column + cell.ColumnSpan - 1] + this->columns.Items[cell.Column + cell.ColumnSpan - 1].Size;
+
+				align(top, bottom, element->Height, cell.AlignY);
+				align(left, right, element->Width, cell.AlignX);
+				element->Place({ left, top, right, bottom });
+			}
+
+			this->disjoint = this->exclusive();
+		}
+		auto Render(Buffer& buf) -> void override {
+			Utility::RenderAll(this->elements, buf, this->disjoint);
+		}
+
+	public:
+		int GapY = 0;
+		int GapX = 0;
+
+	private:
+		class Cell final {
+		public:
+			int Row = 0;
+			int Column = 0;
+			int RowSpan = 1;
+			int ColumnSpan = 1;
+			Align AlignY = Align::Start;
+			Align AlignX = Align::Start;
+		};
+		class Axis final {
+		public:
+			auto Measure(const std::vector<Cell>& cells, const std::vector<std::shared_ptr<Renderable>>& elements, int gap, int Cell::* start, int Cell::* span, int Renderable::* size) -> void {
+				int count = static_cast<int>(this->Tracks.size());
+				this->Items.assign(count, Utility::FlexItem());
+				this->Weight = 0;
+
+				for (int i = 0; i < count; ++i) {
+					const Track& track = this->Tracks[i];
+					Utility::FlexItem& item = this->Items[i];
+					if (track.Kind == Track::Type::Fixed) {
+						item.Base = item.Min = item.Max = track.Value;
+					}
+					else if (track.Kind == Track::Type::Fraction) {
+						item.Grow = track.Value;
+						this->Weight += track.Value;
+					}
+				}
+
+				// Anak dengan satu track dahulu, lalu anak yang melintasi beberapa track menambah kekurangannya
+				// pada track terakhir yang tidak tetap
+				for (size_t i = 0; i < cells.size(); ++i) {
+					const Cell& cell = cells[i];
+					if (cell.*span == 1 && this->Tracks[cell.*start].Kind != Track::Type::Fixed) {
+						Utility::FlexItem& item = this->Items[cell.*start];
+						item.Base = std::max(item.Base, (*elements[i]).*size);
+					}
+				}
+				for (size_t i = 0; i < cells.size(); ++i) {
+					const Cell& cell = cells[i];
+					if (cell.*span == 1) {
+						continue;
+					}
+
+					int covered = gap * (cell.*span - 1);
+					int flexible = -1;
+					for (int t = cell.*start; t < cell.*start + cell.*span; ++t) {
+						covered += this->Items[t].Base;
+						if (this->Tracks[t].Kind != Track::Type::Fixed) {
+							flexible = t;
+						}
+					}
+					if (flexible >= 0 && (*elements[i]).*size > covered) {
+						this->Items[flexible].Base += (*elements[i]).*size - covered;
+					}
+				}
+
+				this->Total = gap * std::max(count - 1, 0);
+				for (const auto& item : this->Items) {
+					this->Total += item.Base;
+				}
+			}
+			auto Arrange(int origin, int space, int gap) -> void {
+				int count = static_cast<int>(this->Items.size());
+				Utility::Flex(this->Items.data(), count, space - gap * std::max(count - 1, 0));
+
+				this->Offsets.resize(count);
+				for (int i = 0; i < count; ++i) {
+					this->Offsets[i] = origin;
+					origin += this->Items[i].Size + gap;
+				}
+			}
+
+		public:
+			std::vector<Track> Tracks;
+			std::vector<Utility::FlexItem> Items;
+			std::vector<int> Offsets;
+			int Weight = 0;
+			int Total = 0;
+		};
+
+	private:
+		static auto align(int& begin, int& end, int size, Align alignment) -> void {
+			if (alignment == Align::Stretch || size >= end - begin) {
+				return;
+			}
+
+			if (alignment == Align::Start) {
+				end = begin + size;
+			}
+			else if (alignment == Align::End) {
+				begin = end - size;
+			}
+			else {
+				begin += (end - begin - size) / 2;
+				end = begin + size;
+			}
+		}
+		// Sel yang tidak berbagi track tidak tumpang tindih selama gap tidak negatif
+		auto exclusive() -> bool {
+			if (this->GapY < 0 || this->GapX < 0) {
+				return false;
+			}
+
+			size_t width = this->columns.Tracks.size();
+			this->occupied.assign(this->rows.Tracks.size() * width, false);
+			for (const Cell& cell : this->cells) {
+				for (int row = cell.Row; row < cell.Row + cell.RowSpan; ++row) {
+					for (int column = cell.Column; column < cell.Column + cell.ColumnSpan; ++column) {
+						auto used = this->occupied[row * width + column];
+						if (used) {
+							return false;
+						}
+						used = true;
+					}
+				}
+			}
+			return true;
+		}
+
+	private:
+		Axis rows;
+		Axis columns;
+		std::vector<Cell> cells;
+		std::vector<std::shared_ptr<Renderable>> elements;
+		std::vector<bool> occupied;
+		bool disjoint = false;
+		bool measured = false;
+		int measuredGapY = 0;
+		int measuredGapX = 0;
+	};
+	class Text final : public Base::Renderable {
+	public:
+		Text(std::string value) :
+			value(std::move(value)),
+			columns(Unicode::Columns(this->value)) {
+		}
+
+		auto Init() -> void override {
+			Renderable::Height = 1;
+			Renderable::Width = this->columns;
+		}
+		auto Render(Buffer& buf) -> void {
+			// Render value kedalam buffer, sisa yang tidak muat dilanjutkan ke baris berikutnya
+			std::string_view text = this->value;
+			for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom && !text.empty(); ++y) {
+				text.remove_prefix(buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text));
+			}
+		}
+
+	private:
+		std::string value;
+		int columns;
+	};
+
+	// Text dengan beberapa style dalam satu node. Markup diurai sekali menjadi run (style, rentang byte),
+	// render menulis glyph dan style sekaligus tanpa node atau modifier per bagian.
+	// Tag: [b] [d] [i] [u] [k] [r] [h] [s] untuk bold, dim, italic, underline, blink, invert, invisible,
+	// strikethrough; [fg=nama] atau [fg=#rrggbb], begitu juga [bg=...]; [/] menutup tag terakhir; [[ untuk '['
+	class RichText final : public Base::Renderable {
+	public:
+		class Span final {
+		public:
+			std::string Text;
+			Pixel Style;
+		};
+
+		RichText(std::string_view markup) {
+			this->parse(markup);
+			this->columns = Unicode::Columns(this->text);
+		}
+		RichText(std::vector<Span> spans) {
+			for (auto& span : spans) {
+				this->runs.push_back({ this->text.size(), this->text.size() + span.Text.size(), span.Style });
+				this->text += span.Text;
+			}
+			this->columns = Unicode::Columns(this->text);
+		}
+
+		auto Init() -> void override {
+			Renderable::Height = 1;
+			Renderable::Width = this->columns;
+		}
+		auto Render(Buffer& buf) -> void override {
+			std::string_view text = this->text;
+			size_t pos = 0;
+			size_t run = 0;
+
+			// Run terurut sehingga cukup maju satu arah selama glyph ditulis
+			auto style = [&](Pixel& pixel, size_t offset) {
+				offset += pos;
+				while (run < this->runs.size() && this->runs[run].End <= offset) {
+					++run;
+				}
+				if (run < this->runs.size() && this->runs[run].Begin <= offset) {
+					paint(pixel, this->runs[run].Style);
+				}
+				};
+
+			for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom && pos < text.size(); ++y) {
+				pos += buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text.substr(pos), style);
+			}
+		}
+
+	private:
+		class Run final {
+		public:
+			size_t Begin;
+			size_t End;
+			Pixel Style;
+		};
+
+	private:
+		auto parse(std::string_view markup) -> void {
+			std::vector<Pixel> styles{ Pixel() };
+			size_t begin = 0;
+			auto flush = [&]() {
+				if (this->text.size() > begin) {
+					this->runs.push_back({ begin, this->text.size(), styles.back() });
+				}
+				begin = this->text.size();
+				};
+
+			for (size_t i = 0; i < markup.size(); ) {
+				if (markup[i] == '[' && i + 1 < markup.size() && markup[i + 1] == '[') {
+					this->text += '[';
+					i += 2;
+					continue;
+				}
+
+				size_t close = markup[i] == '[' ? markup.find(']', i) : std::string_view::npos;
+				if (close != std::string_view::npos) {
+					std::string_view tag = markup.substr(i + 1, close - i - 1);
+					Pixel style = styles.back();
+
+					if (tag == "/" && styles.size() > 1) {
+						flush();
+						styles.pop_back();
+						i = close + 1;
+						continue;
+					}
+					if (apply(tag, style)) {
+						flush();
+						styles.push_back(style);
+						i = close + 1;
+						continue;
+					}
+				}
+
+				// Tag yang tidak dikenal ditulis apa adanya
+				this->text += markup[i++];
+			}
+			flush();
+		}
+		static auto apply(std::string_view tag, Pixel& style) -> bool {
+			if (tag.size() == 1) {
+				switch (tag[0]) {
+				case 'b': style.Bold = true; return true;
+				case 'd': style.Dim = true; return true;
+				case 'i': style.Italic = true; return true;
+				case 'u': style.Underline = true; return true;
+				case 'k': style.Blink = true; return true;
+				case 'r': style.Invert = true; return true;
+				case 'h': style.Invisible = true; return true;
+				case 's': style.Strikethrough = true; return true;
+				}
+				return false;
+			}
+
+			if (tag.size() > 3 && (tag.substr(0, 3) == "fg=" || tag.substr(0, 3) == "bg=")) {
+				Color color = Palette16::Default;
+				if (!parseColor(tag.substr(3), color)) {
+					return false;
+				}
+
+				(tag[0] == 'f' ? style.Foreground : style.Background) = color;
+				return true;
+			}
+
+			return false;
+		}
+		static auto parseColor(std::string_view name, Color& color) -> bool {
+			if (name.size() == 7 && name[0] == '#') {
+				// Hanya enam digit hex yang diterima, selain itu tag ditulis apa adanya
+				if (!std::all_of(name.begin() + 1, name.end(), [](char ch) { return std::isxdigit(static_cast<unsigned char>(ch)) != 0; })) {
+					return false;
+				}
+				color = Color(std::string(name));
+				return true;
+			}
+
+			static const std::pair<std::string_view, Palette16> names[] = {
+				{ "black", Palette16::Black }, { "red", Palette16::Red }, { "green", Palette16::Green },
+				{ "yellow", Palette16::Yellow }, { "blue", Palette16::Blue }, { "magenta", Palette16::Magenta },
+				{ "cyan", Palette16::Cyan }, { "white", Palette16::White },
+				{ "brightblack", Palette16::BrightBlack }, { "brightred", Palette16::BrightRed },
+				{ "brightgreen", Palette16::BrightGreen }, { "brightyellow", Palette16::BrightYellow },
+				{ "brightblue", Palette16::BrightBlue }, { "brightmagenta", Palette16::BrightMagenta },
+				{ "brightcyan", Palette16::BrightCyan }, { "brightwhite", Palette16::BrightWhite }
+			};
+			for (const auto& entry : names) {
+				if (entry.first == name) {
+					color = entry.second;
+					return true;
+				}
+			}
+
+			return false;
+		}
+		// Atribut ditambahkan, warna hanya diganti jika run menentukannya, sehingga modifier luar tetap berlaku
+		static auto paint(Pixel& pixel, const Pixel& style) -> void {
+			pixel.Bold |= style.Bold;
+			pixel.Dim |= style.Dim;
+			pixel.Italic |= style.Italic;
+			pixel.Underline |= style.Underline;
+			pixel.Blink |= style.Blink;
+			pixel.Invert |= style.Invert;
+			pixel.Invisible |= style.Invisible;
+			pixel.Strikethrough |= style.Strikethrough;
+			if (!style.Foreground.IsDefault()) {
+				pixel.Foreground = style.Foreground;
+			}
+			if (!style.Background.IsDefault()) {
+				pixel.Background = style.Background;
+			}
+		}
+
+	private:
+		std::string text;
+		std::vector<Run> runs;
+		int columns = 0;
+	};
+
+	// Text panjang dengan word wrap. Posisi awal tiap baris disimpan per paragraf untuk lebar terakhir,
+	// sehingga edit hanya membungkus ulang paragraf yang berubah dan menyambung barisnya ke daftar baris,
+	// dan lompat ke baris N cukup satu index
+	class Paragraph final : public Base::Renderable, public Base::Focusable {
+	public:
+		Paragraph(std::string_view text) {
+			for (size_t begin = 0; begin <= text.size(); ) {
+				size_t end = std::min(text.find('\n', begin), text.size());
+				this->blocks.emplace_back(std::string(text.substr(begin, end - begin)));
+				begin = end + 1;
+			}
+		}
+
+		auto Init() -> void override {
+			if (Renderable::Width == 0) {
+				Renderable::Width = 40;
+			}
+			if (Renderable::Height == 0) {
+				this->fit = true;
+			}
+
+			// Tinggi mengikuti jumlah baris pada lebar yang terakhir dipakai agar cache tidak bergantian lebar
+			if (this->fit) {
+				this->wrap(this->columns > 0 ? this->columns : Renderable::Width);
+				Renderable::Height = std::max(static_cast<int>(this->lines.size()), 1);
+			}
+		}
+		auto Set(Rectangle dimension) -> void override {
+			Renderable::Set(dimension);
+
+			this->wrap(dimension.Right - dimension.Left);
+			this->Scroll(this->top);
+
+			// Jumlah baris pada lebar sebenarnya berbeda dengan tinggi yang diukur, minta layout ulang
+			if (this->fit && Renderable::Height != std::max(static_cast<int>(this->lines.size()), 1)) {
+				Renderable::Dirty = true;
+				Renderable::Relayout() = true;
+			}
+		}
+		auto Render(Buffer& buf) -> void override {
+			for (int y = Renderable::Dimension.Top, i = this->top; y < Renderable::Dimension.Bottom && i < static_cast<int>(this->lines.size()); ++y, ++i) {
+				const Row& line = this->lines[i];
+				std::string_view text = this->blocks[line.Block].Text;
+				buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text.substr(line.Begin, line.End - line.Begin));
+			}
+		}
+
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			int page = std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 1);
+			int top = this->top;
+
+			switch (keyEvent.wVirtualKeyCode) {
+			case VK_UP: this->Scroll(top - 1); break;
+			case VK_DOWN: this->Scroll(top + 1); break;
+			case VK_PRIOR: this->Scroll(top - page); break;
+			case VK_NEXT: this->Scroll(top + page); break;
+			case VK_HOME: this->Scroll(0); break;
+			case VK_END: this->Scroll(this->Lines()); break;
+			}
+
+			return this->top != top;
+		}
+
+		// Baris pertama yang terlihat, dibatasi agar halaman terakhir tetap penuh
+		auto Scroll(int line) -> void {
+			int page = Renderable::Dimension.Bottom - Renderable::Dimension.Top;
+			this->top = std::max(std::min(line, static_cast<int>(this->lines.size()) - page), 0);
+		}
+		auto Line() -> int {
+			return this->top;
+		}
+		auto Lines() -> int {
+			return static_cast<int>(this->lines.size());
+		}
+		auto Paragraphs() -> int {
+			return static_cast<int>(this->blocks.size());
+		}
+
+		// Edit per paragraf, hanya paragraf tersebut yang dibungkus ulang dan barisnya disambung ke daftar baris.
+		// Insert dan Erase juga menggeser nomor paragraf pada baris sesudahnya
+		auto Replace(int paragraph, std::string text) -> void {
+			this->blocks[paragraph] = Block(std::move(text));
+			if (!this->stale) {
+				auto range = this->range(paragraph);
+				this->splice(paragraph, this->lines.erase(range.first, range.second));
+			}
+			this->changed();
+		}
+		auto Insert(int paragraph, std::string text) -> void {
+			this->blocks.insert(this->blocks.begin() + paragraph, Block(std::move(text)));
+			if (!this->stale) {
+				auto at = this->range(paragraph).first;
+				for (auto it = at; it != this->lines.end(); ++it) {
+					++it->Block;
+				}
+				this->splice(paragraph, at);
+			}
+			this->changed();
+		}
+		auto Append(std::string text) -> void {
+			this->blocks.emplace_back(std::move(text));
+			if (!this->stale) {
+				this->splice(static_cast<int>(this->blocks.size()) - 1, this->lines.end());
+			}
+			this->changed();
+		}
+		auto Erase(int paragraph) -> void {
+			this->blocks.erase(this->blocks.begin() + paragraph);
+			if (!this->stale) {
+				auto range = this->range(paragraph);
+				for (auto it = this->lines.erase(range.first, range.second); it != this->lines.end(); ++it) {
+					--it->Block;
+				}
+			}
+			this->changed();
+		}
+
+	private:
+		class Block final {
+		public:
+			Block(std::string text) :
+				Text(std::move(text)) {
+			}
+
+		public:
+			std::string Text;
+			// Offset byte awal tiap baris untuk lebar Columns, kosong berarti perlu dibungkus ulang
+			std::vector<uint32_t> Starts;
+			int Columns = 0;
+		};
+		class Row final {
+		public:
+			int Block;
+			uint32_t Begin;
+			uint32_t End;
+		};
+
+	private:
+		auto changed() -> void {
+			Renderable::Dirty = true;
+		}
+		// Rentang baris milik paragraf, baris selalu terurut menurut paragraf
+		auto range(int paragraph) -> std::pair<std::vector<Row>::iterator, std::vector<Row>::iterator> {
+			auto first = std::lower_bound(this->lines.begin(), this->lines.end(), paragraph, [](const Row& row, int block) { return row.Block < block; });
+			auto last = std::find_if(first, this->lines.end(), [paragraph](const Row& row) { return row.Block != paragraph; });
+			return { first, last };
+		}
+		// Bungkus satu paragraf pada lebar terakhir lalu sisipkan barisnya pada posisi at
+		auto splice(int paragraph, std::vector<Row>::iterator at) -> void {
+			breaks(this->blocks[paragraph], this->columns);
+
+			std::vector<Row> rows;
+			this->rows(paragraph, rows);
+			this->lines.insert(at, rows.begin(), rows.end());
+		}
+		auto rows(int paragraph, std::vector<Row>& out) const -> void {
+			const Block& block = this->blocks[paragraph];
+			for (size_t line = 0; line < block.Starts.size(); ++line) {
+				uint32_t end = line + 1 < block.Starts.size() ? block.Starts[line + 1] : static_cast<uint32_t>(block.Text.size());
+				out.push_back({ paragraph, block.Starts[line], end });
+			}
+		}
+		auto wrap(int columns) -> void {
+			columns = std::max(columns, 1);
+			if (columns == this->columns && !this->stale) {
+				return;
+			}
+
+			Utility::ThreadPool::Run(static_cast<int>(this->blocks.size()), [&](int i) {
+				Block& block = this->blocks[i];
+				if (block.Columns != columns || block.Starts.empty()) {
+					breaks(block, columns);
+				}
+				});
+
+			this->lines.clear();
+			for (int i = 0; i < static_cast<int>(this->blocks.size()); ++i) {
+				this->rows(i, this->lines);
+			}
+
+			this->columns = columns;
+			this->stale = false;
+		}
+		// Putus baris setelah spasi terakhir yang muat, kata yang lebih panjang dari satu baris dipotong paksa
+		static auto breaks(Block& block, int columns) -> void {
+			std::string_view text = block.Text;
+			block.Starts.assign(1, 0);
+			block.Columns = columns;
+
+			size_t breakAt = 0;
+			int column = 0;
+			int breakColumn = 0;
+			for (size_t pos = 0; pos < text.size(); ) {
+				size_t begin = pos;
+				int width = Unicode::Cluster(text, pos);
+				bool space = text[begin] == ' ';
+
+				if (column + width > columns) {
+					if (space) {
+						block.Starts.push_back(static_cast<uint32_t>(pos));
+						column = 0;
+						breakAt = pos;
+						breakColumn = 0;
+						continue;
+					}
+					if (breakAt > block.Starts.back()) {
+						block.Starts.push_back(static_cast<uint32_t>(breakAt));
+						column -= breakColumn;
+					}
+					else {
+						block.Starts.push_back(static_cast<uint32_t>(begin));
+						column = 0;
+					}
+					breakColumn = 0;
+				}
+
+				column += width;
+				if (space) {
+					breakAt = pos;
+					breakColumn = column;
+				}
+			}
+		}
+
+	private:
+		std::vector<Block> blocks;
+		std::vector<Row> lines;
+		int columns = 0;
+		int top = 0;
+		bool stale = true;
+		bool fit = false;
+	};
+
+	class VerticalContainer final : public Base::Focusable {
+	public:
+		VerticalContainer(std::vector<std::shared_ptr<Focusable>> components) :
+			components(std::move(components)) {
+		}
+
+		auto Focused(bool flag) -> void {
+			Focusable::Focused(flag);
+
+			this->components[this->focusedComponent]->Focused(flag);
+		}
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			if (this->components[this->focusedComponent]->OnKey(keyEvent)) {
+				return true;
+			}
+
+			if (
+				((keyEvent.dwControlKeyState & SHIFT_PRESSED) && keyEvent.wVirtualKeyCode == VK_TAB) ||
+				keyEvent.wVirtualKeyCode == VK_UP ||
+				keyEvent.uChar.AsciiChar == 'k' ||
+				keyEvent.uChar.AsciiChar == 'K'
+				) {
+				if (this->focusedComponent > 0) {
+					this->components[this->focusedComponent]->Focused(false);
+					this->components[--this->focusedComponent]->Focused(true);
+					return true;
+				}
+
+				return false;
+			}
+
+			if (
+				keyEvent.wVirtualKeyCode == VK_TAB ||
+				keyEvent.wVirtualKeyCode == VK_DOWN ||
+				keyEvent.uChar.AsciiChar == 'j' ||
+				keyEvent.uChar.AsciiChar == 'J'
+				) {
+				if (this->focusedComponent < this->components.size() - 1) {
+					this->components[this->focusedComponent]->Focused(false);
+					this->components[++this->focusedComponent]->Focused(true);
+					return true;
+				}
+
+				return false;
+			}
+
+			return false;
+		}
+
+	private:
+		int focusedComponent = 0;
+		std::vector<std::shared_ptr<Focusable>> components;
+	};
+	class HorizontalContainer final : public Base::Focusable {
+	public:
+		HorizontalContainer(std::vector<std::shared_ptr<Focusable>> components) :
+			components(std::move(components)) {
+		}
+
+		auto Focused(bool flag) -> void {
+			Focusable::Focused(flag);
+
+			this->components[this->focusedComponent]->Focused(flag);
+		}
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			if (this->components[this->focusedComponent]->OnKey(keyEvent)) {
+				return true;
+			}
+
+			if (
+				((keyEvent.dwControlKeyState & SHIFT_PRESSED) && keyEvent.wVirtualKeyCode == VK_TAB) ||
+				keyEvent.wVirtualKeyCode == VK_LEFT ||
+				keyEvent.uChar.AsciiChar == 'h' ||
+				keyEvent.uChar.AsciiChar == 'H'
+				) {
+				if (this->focusedComponent > 0) {
+					this->components[this->focusedComponent]->Focused(false);
+					this->components[--this->focusedComponent]->Focused(true);
+					return true;
+				}
+
+				return false;
+			}
+
+			if (
+				keyEvent.wVirtualKeyCode == VK_TAB ||
+				keyEvent.wVirtualKeyCode == VK_RIGHT ||
+				keyEvent.uChar.AsciiChar == 'l' ||
+				keyEvent.uChar.AsciiChar == 'L'
+				) {
+				if (this->focusedComponent < this->components.size() - 1) {
+					this->components[this->focusedComponent]->Focused(false);
+					this->components[++this->focusedComponent]->Focused(true);
+					return true;
+				}
+
+				return false;
+			}
+
+			return false;
+		}
+
+	private:
+		int focusedComponent = 0;
+		std::vector<std::shared_ptr<Focusable>> components;
+	};
+	class Button final : public Base::Renderable, public Base::Focusable {
+	public:
+		Button(std::string name) :
+			name(std::move(name)),
+			columns(Unicode::Columns(this->name)) {
+		}
+		Button(std::string name, std::function<void()> logic) :
+			name(std::move(name)),
+			columns(Unicode::Columns(this->name)),
+			logic(std::move(logic)) {
+		}
+
+		auto Init() -> void override {
+			Renderable::Height = 1;
+			Renderable::Width = this->columns + 2;
+		}
+		auto Render(Buffer& buf) -> void override {
+			// Render [] kedalam buffer
+			buf.At(Renderable::Dimension.Top, Renderable::Dimension.Left).Value = "[";
+			buf.At(Renderable::Dimension.Top, Renderable::Dimension.Right - 1).Value = "]";
+
+			// Render name kedalam buffer
+			buf.Write(Renderable::Dimension.Top, Renderable::Dimension.Left + 1, Renderable::Dimension.Right - 1, this->name);
+
+			// Jika cursor focus maka invert foreground dan background
+			if (Focusable::Focused()) {
+				for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
+					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
+						buf.At(y, x).Invert = true;
+					}
+				}
+			}
+		}
+
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			switch (keyEvent.wVirtualKeyCode) {
+			case VK_RETURN:
+				if (this->logic) {
+					logic();
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		std::string name;
+		int columns;
+		std::function<void()> logic;
+	};
+	class Dropdown final : public Base::Renderable, public Base::Focusable {
+	public:
+		Dropdown(std::vector<std::string>&& values) :
+			values(std::move(values)) {
+			this->measure();
+		}
+		Dropdown(const std::vector<std::string>& values) :
+			values(values) {
+			this->measure();
+		}
+		Dropdown(std::string placeholder, std::vector<std::string>&& values) :
+			placeholder(std::move(placeholder)),
+			values(std::move(values)) {
+			this->measure();
+		}
+		Dropdown(std::string placeholder, const std::vector<std::string>& values) :
+			placeholder(std::move(placeholder)),
+			values(values) {
+			this->measure();
+		}
+
+		auto Init() -> void override {
+			if (Renderable::Width == 0) {
+				Renderable::Width = this->columns + 1;
+			}
+			Renderable::Height = Focusable::Focused() ? std::min(7, static_cast<int>(this->values.size())) : 1;
+		}
+		auto Render(Buffer& buf) -> void override {
+			// Render area untuk dropdown
+			for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
+				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
+					buf.At(y, x).Invert = true;
+				}
+			}
+
+			if (Focusable::Focused()) {
+				// Render list values kedalam buffer
+				for (int y = Renderable::Dimension.Top, i = this->textBegin; y < Renderable::Dimension.Bottom; ++y, ++i) {
+					buf.Write(y, Renderable::Dimension.Left + 1, Renderable::Dimension.Right, this->values[i]);
+
+					// Tandai index yang telah dipilih
+					if (i == this->selectedIndex) {
+						buf.At(y, Renderable::Dimension.Left).Value = "*";
+					}
+				}
+
+				// Tandai index yang sedang focus
+				for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
+					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
+						buf.At(Renderable::Dimension.Top + this->yCursor, x).Invert = false;
+					}
+				}
+
+				return;
+			}
+
+			// Jika index belum dipilih dan placeholder diisi maka
+			// render placeholder kedalam buffer
+			if (this->selectedIndex < 0 && !this->placeholder.empty()) {
+				int right = std::min(Renderable::Dimension.Right, Renderable::Dimension.Left + this->placeholderColumns);
+				for (int x = Renderable::Dimension.Left; x < right; ++x) {
+					buf.At(Renderable::Dimension.Top, x).Italic = true;
+				}
+				buf.Write(Renderable::Dimension.Top, Renderable::Dimension.Left, Renderable::Dimension.Right, this->placeholder);
+			}
+			// Jika index telah dipilih maka render index kedalam buffer
+			else if (this->selectedIndex >= 0) {
+				buf.Write(Renderable::Dimension.Top, Renderable::Dimension.Left, Renderable::Dimension.Right, this->values[this->selectedIndex]);
+			}
+		}
+
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			if (
+				keyEvent.wVirtualKeyCode == VK_DOWN ||
+				keyEvent.uChar.AsciiChar == 'j' ||
+				keyEvent.uChar.AsciiChar == 'J'
+				) {
+				if (this->index < this->values.size() - 1) {
+					++this->index;
+					this->moveCursor(1);
+					return true;
+				}
+
+				return false;
+			}
+
+			if (
+				keyEvent.wVirtualKeyCode == VK_UP ||
+				keyEvent.uChar.AsciiChar == 'k' ||
+				keyEvent.uChar.AsciiChar == 'K'
+				) {
+				if (this->index > 0) {
+					--this->index;
+					this->moveCursor(-1);
+					return true;
+				}
+
+				return false;
+			}
+
+			if (keyEvent.wVirtualKeyCode == VK_RETURN) {
+				this->selectedIndex = this->index;
+				return true;
+			}
+
+			return false;
+		}
+
+	private:
+		// Lebar terpanjang dihitung sekali karena daftar values tidak berubah
+		auto measure() -> void {
+			this->placeholderColumns = Unicode::Columns(this->placeholder);
+			this->columns = this->placeholderColumns;
+			for (const auto& value : this->values) {
+				this->columns = std::max(this->columns, Unicode::Columns(value));
+			}
+		}
+		auto moveCursor(int y) -> void {
+			if (y > 0) {
+				if (this->yCursor < Renderable::Height - 1) {
+					++this->yCursor;
+				}
+				else { ++textBegin; }
+			}
+			else if (y < 0) {
+				if (this->yCursor > 0) {
+					--this->yCursor;
+				}
+				else { --textBegin; }
+			}
+		}
+
+	private:
+		int index = 0;
+		int selectedIndex = -1;
+		int yCursor = 0;
+		int textBegin = 0;
+		int columns = 0;
+		int placeholderColumns = 0;
+		std::string placeholder;
+		std::vector<std::string> values;
+	};
+	// Penyedia saran untuk Input. Kandidat dinilai dengan fuzzy subsequence secara paralel per chunk pada ThreadPool
+	// aktif dan setiap chunk menyimpan K terbaik dalam heap. Query yang diperpanjang hanya menilai kandidat yang cocok
+	// dengan prefix-nya, dan query yang sedang dinilai dibatalkan begitu query baru masuk
+	class Completion final {
+	public:
+		class Match final {
+		public:
+			uint32_t Index = 0;
+			int Score = 0;
+		};
+
+		Completion(std::vector<std::string> candidates, size_t limit = 8) :
+			candidates(std::move(candidates)),
+			limit(std::max<size_t>(limit, 1)),
+			wheel(TimerWheel::Current()) {
+			this->worker = std::thread([this]() { this->loop(); });
+		}
+		Completion(const Completion&) = delete;
+		auto operator =(const Completion&) -> Completion& = delete;
+		~Completion() {
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->stopping = true;
+				this->generation.fetch_add(1, std::memory_order_relaxed);
+			}
+			this->wake.notify_one();
+			this->worker.join();
+		}
+
+		// Kirim query tanpa menunggu hasil
+		auto Query(std::string query) -> void {
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->query = std::move(query);
+				this->generation.fetch_add(1, std::memory_order_relaxed);
+			}
+			this->wake.notify_one();
+		}
+		// Bertambah setiap kali hasil baru diterbitkan
+		auto Version() const -> uint64_t {
+			return this->version.load(std::memory_order_acquire);
+		}
+		// Maksimal limit kandidat terbaik untuk query terakhir yang selesai dinilai
+		auto Results() -> std::vector<Match> {
+			std::lock_guard<std::mutex> lock(this->mutex);
+			return this->results;
+		}
+		// Sama seperti Results, query yang menghasilkan hasil tersebut ikut disalin. Hasil bisa tertinggal dari
+		// Query terakhir selama penilai belum selesai
+		auto Results(std::string& query) -> std::vector<Match> {
+			std::lock_guard<std::mutex> lock(this->mutex);
+			query = this->answered;
+			return this->results;
+		}
+		auto Candidate(size_t index) const -> const std::string& {
+			return this->candidates[index];
+		}
+		auto Size() const -> size_t {
+			return this->candidates.size();
+		}
+
+		// Nilai query terhadap candidate tanpa membedakan huruf besar kecil, -1 jika query bukan subsequence.
+		// Huruf di awal kata dan huruf yang berurutan mendapat bonus, celah di antara huruf mendapat penalti
+		static auto Score(std::string_view query, std::string_view candidate) -> int {
+			int score = 0;
+			size_t j = 0;
+			size_t last = std::string_view::npos;
+
+			for (size_t i = 0; i < candidate.size() && j < query.size(); ++i) {
+				char ch = candidate[i];
+				if (Lower(ch) != Lower(query[j])) {
+					continue;
+				}
+
+				int bonus = 16;
+				if (i == 0 || boundary(candidate[i - 1], ch)) {
+					bonus += 24;
+				}
+				if (last == std::string_view::npos) {
+					bonus -= static_cast<int>(std::min<size_t>(i, 12));
+				}
+				else {
+					bonus += last + 1 == i ? 16 : -static_cast<int>(std::min<size_t>(i - last - 1, 12));
+				}
+				if (ch == query[j]) {
+					bonus += 2;
+				}
+
+				score += bonus;
+				last = i;
+				++j;
+			}
+
+			return j == query.size() ? score : -1;
+		}
+		static auto Lower(char ch) -> char {
+			return ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+		}
+
+	public:
+		// Dipanggil dari thread penilai setelah hasil diterbitkan, pasang sebelum Query pertama. Event loop juga
+		// dibangunkan lewat TimerWheel yang aktif saat Completion dibuat
+		std::function<void()> Ready;
+
+	private:
+		// Kandidat yang cocok dengan sebuah query, terurut sesuai index
+		class Survivors final {
+		public:
+			std::string Query;
+			std::vector<uint32_t> Indices;
+		};
+
+		static auto boundary(char previous, char ch) -> bool {
+			return
+				previous == '/' || previous == '\\' || previous == '_' || previous == '-' ||
+				previous == '.' || previous == ' ' || previous == ':' ||
+				(previous >= 'a' && previous <= 'z' && ch >= 'A' && ch <= 'Z');
+		}
+		// Urutan hasil: skor tertinggi, lalu kandidat terpendek, lalu index terkecil
+		auto better(const Match& a, const Match& b) const -> bool {
+			if (a.Score != b.Score) {
+				return a.Score > b.Score;
+			}
+			size_t x = this->candidates[a.Index].size();
+			size_t y = this->candidates[b.Index].size();
+			return x != y ? x < y : a.Index < b.Index;
+		}
+		// Heap berukuran limit dengan hasil terburuk di depan
+		auto push(std::vector<Match>& heap, Match match) const -> void {
+			auto worse = [this](const Match& a, const Match& b) { return this->better(a, b); };
+			if (heap.size() < this->limit) {
+				heap.push_back(match);
+				std::push_heap(heap.begin(), heap.end(), worse);
+			}
+			else if (this->better(match, heap.front())) {
+				std::pop_heap(heap.begin(), heap.end(), worse);
+				heap.back() = match;
+				std::push_heap(heap.begin(), heap.end(), worse);
+			}
+		}
+		auto loop() -> void {
+			uint64_t seen = 0;
+
+			while (true) {
+				std::string query;
+				{
+					std::unique_lock<std::mutex> lock(this->mutex);
+					this->wake.wait(lock, [&] { return this->stopping || this->generation.load(std::memory_order_relaxed) != seen; });
+					if (this->stopping) {
+						return;
+					}
+
+					seen = this->generation.load(std::memory_order_relaxed);
+					query = this->query;
+				}
+
+				std::vector<Match> results;
+				if (!this->run(query, seen, results)) {
+					continue;
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->results = std::move(results);
+					this->answered = std::move(query);
+				}
+				this->version.fetch_add(1, std::memory_order_release);
+
+				if (this->Ready) {
+					this->Ready();
+				}
+				if (this->wheel != nullptr) {
+					this->wheel->Wake();
+				}
+			}
+		}
+		// Nilai query, false jika dibatalkan oleh query yang lebih baru
+		auto run(const std::string& query, uint64_t generation, std::vector<Match>& results) -> bool {
+			// Riwayat yang bukan prefix query dibuang, sisanya menyimpan kandidat dari prefix terpanjang
+			while (!this->history.empty() && query.compare(0, this->history.back().Query.size(), this->history.back().Query) != 0) {
+				this->history.pop_back();
+			}
+			if (query.empty()) {
+				return true;
+			}
+
+			const std::vector<uint32_t>* from = this->history.empty() ? nullptr : &this->history.back().Indices;
+			size_t count = from != nullptr ? from->size() : this->candidates.size();
+
+			const size_t chunk = 16 * 1024;
+			Utility::ThreadPool* pool = Utility::ThreadPool::Current();
+			size_t batch = pool != nullptr ? static_cast<size_t>(pool->Size()) : 1;
+			size_t chunks = (count + chunk - 1) / chunk;
+
+			std::vector<std::vector<uint32_t>> matched(chunks);
+			std::vector<std::vector<Match>> heaps(chunks);
+
+			// Dikirim per batch agar pool tidak tertahan lama untuk render dan pembatalan cepat terlihat
+			for (size_t first = 0; first < chunks; first += batch) {
+				if (this->generation.load(std::memory_order_relaxed) != generation) {
+					return false;
+				}
+
+				Utility::ThreadPool::Run(static_cast<int>(std::min(batch, chunks - first)), [&](int i) {
+					size_t c = first + i;
+					for (size_t k = c * chunk, end = std::min(k + chunk, count); k < end; ++k) {
+						uint32_t index = from != nullptr ? (*from)[k] : static_cast<uint32_t>(k);
+						int score = Score(query, this->candidates[index]);
+						if (score >= 0) {
+							matched[c].push_back(index);
+							this->push(heaps[c], { index, score });
+						}
+					}
+					});
+			}
+			if (this->generation.load(std::memory_order_relaxed) != generation) {
+				return false;
+			}
+
+			if (this->history.empty() || this->history.back().Query != query) {
+				Survivors survivors;
+				survivors.Query = query;
+				for (const auto& indices : matched) {
+					survivors.Indices.insert(survivors.Indices.end(), indices.begin(), indices.end());
+				}
+				this->history.push_back(std::move(survivors));
+			}
+
+			for (const auto& heap : heaps) {
+				results.insert(results.end(), heap.begin(), heap.end());
+			}
+			std::sort(results.begin(), results.end(), [this](const Match& a, const Match& b) { return this->better(a, b); });
+			if (results.size() > this->limit) {
+				results.resize(this->limit);
+			}
+			return true;
+		}
+
+	private:
+		std::vector<std::string> candidates;
+		size_t limit;
+		std::vector<Survivors> history;
+		std::mutex mutex;
+		std::condition_variable wake;
+		std::string query;
+		std::vector<Match> results;
+		std::string answered;
+		std::atomic<uint64_t> generation{ 0 };
+		std::atomic<uint64_t> version{ 0 };
+		bool stopping = false;
+		TimerWheel* wheel;
+		std::thread worker;
+	};
+	class Input final : public Base::Renderable, public Base::Focusable {
+	public:
+		Input() = default;
+		Input(std::string placeholder) :
+			placeholder(std::move(placeholder)),
+			placeholderColumns(Unicode::Columns(this->placeholder)) {
+		}
+
+		auto Init() -> void override {
+			if (Renderable::Height == 0) {
+				Renderable::Height = 1;
+			}
+			if (Renderable::Width == 0) {
+				Renderable::Width = 30;
+			}
+
+			// Baris saran ditambahkan di bawah area input selama focus, tinggi asli disimpan di rows
+			if (!this->completion) {
+				this->rows = Renderable::Height;
+				return;
+			}
+			if (this->rows == 0) {
+				this->rows = Renderable::Height;
+			}
+			if (this->completion->Version() != this->version) {
+				this->version = this->completion->Version();
+				this->suggestions = this->completion->Results(this->answered);
+				this->selected = 0;
+			}
+			Renderable::Height = this->rows + this->shown();
+		}
+		auto Render(Buffer& buf) -> void override {
+			int bottom = Renderable::Dimension.Top + this->rows;
+
+			// Render area untuk input
+			for (int y = Renderable::Dimension.Top; y < bottom; ++y) {
+				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
+					buf.At(y, x).Invert = true;
+				}
+			}
+
+			// Render posisi cursor jika focus
+			if (Focusable::Focused()) {
+				buf.At(
+					Renderable::Dimension.Top + this->yCursor,
+					Renderable::Dimension.Left + this->xCursor
+				).Invert = false;
+			}
+
+			// Render placeholder jika terisi
+			if (this->value.empty() && !this->placeholder.empty()) {
+				std::string_view text = this->placeholder;
+				int width = Renderable::Dimension.Right - Renderable::Dimension.Left;
+				for (int y = Renderable::Dimension.Top, columns = this->placeholderColumns; y < bottom && !text.empty(); ++y, columns -= width) {
+					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Left + std::min(columns, width); ++x) {
+						buf.At(y, x).Italic = true;
+					}
+					text.remove_prefix(buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text));
+				}
+
+				return;
+			}
+
+			// Render jika karakter disembunyikan, atau biasa dikenal dengan password
+			if (this->Hide) {
+				for (int y = Renderable::Dimension.Top, i = this->textBegin; y < bottom; ++y) {
+					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
+						if (i < this->value.size()) {
+							buf.At(y, x).Value = u8"•";
+						}
+						else { break; }
+					}
+				}
+
+				return;
+			}
+
+			// Token hanya dihitung ulang setelah value berubah
+			if (this->tokenizer && this->stale) {
+				this->tokens.clear();
+				this->tokenizer->Tokenize(this->value, 0, this->tokens);
+				this->stale = false;
+			}
+
+			// Render karakter biasa
+			size_t token = 0;
+			for (int y = Renderable::Dimension.Top, i = this->textBegin; y < bottom; ++y) {
+				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
+					if (i < this->value.size()) {
+						buf.At(y, x).Value = this->value[i];
+					}
+					else { break; }
+
+					while (token < this->tokens.size() && this->tokens[token].End <= static_cast<uint32_t>(i)) {
+						++token;
+					}
+					if (token < this->tokens.size() && this->tokens[token].Begin <= static_cast<uint32_t>(i)) {
+						this->tokens[token].Apply(buf.At(y, x));
+					}
+				}
+			}
+
+			// Render saran, huruf yang cocok dengan query milik hasil tersebut ditebalkan. Query itu bisa tertinggal
+			// satu ketukan dari value sampai penilai selesai dan membangunkan loop
+			for (int k = 0, count = this->shown(); k < count; ++k) {
+				int y = bottom + k;
+				const std::string& text = this->completion->Candidate(this->suggestions[k].Index);
+				size_t j = 0;
+				size_t last = std::string::npos;
+				bool bold = false;
+				buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text, [&](Pixel& pixel, size_t offset) {
+					if (offset != last) {
+						last = offset;
+						bold = j < this->answered.size() && Completion::Lower(text[offset]) == Completion::Lower(this->answered[j]);
+						j += bold;
+					}
+					pixel.Bold = bold;
+					});
+
+				if (k == static_cast<int>(this->selected)) {
+					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
+						buf.At(y, x).Invert = true;
+					}
+				}
+			}
+		}
+
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			// Selama daftar saran tampil, panah memilih saran, Enter memakai saran dan Escape menutup daftar
+			if (int count = this->shown()) {
+				switch (keyEvent.wVirtualKeyCode) {
+				case VK_DOWN:
+					this->selected = (this->selected + 1) % count;
+					return true;
+				case VK_UP:
+					this->selected = (this->selected + count - 1) % count;
+					return true;
+				case VK_RETURN:
+					this->accept();
+					return true;
+				case VK_ESCAPE:
+					this->dismissed = true;
+					return true;
+				}
+			}
+
+			switch (keyEvent.wVirtualKeyCode) {
+			case VK_LEFT:
+				if (this->index > 0) {
+					--this->index;
+					this->moveCursor(0, -1);
+					return true;
+				}
+				break;
+			case VK_UP:
+				if (this->index - Renderable::Width >= 0) {
+					this->index -= Renderable::Width;
+					this->moveCursor(-1, 0);
+					return true;
+				}
+				break;
+			case VK_RIGHT:
+				if (this->index < this->value.size()) {
+					++this->index;
+					this->moveCursor(0, 1);
+					return true;
+				}
+				break;
+			case VK_DOWN:
+				if (this->index + Renderable::Width <= this->value.size()) {
+					this->index += Renderable::Width;
+					this->moveCursor(1, 0);
+					return true;
+				}
+				break;
+			case VK_BACK:
+				if (this->index > 0) {
+					this->value.erase(this->value.begin() + --this->index);
+					this->moveCursor(0, -1);
+					this->changed();
+					return true;
+				}
+				break;
+			default:
+				if (this->Pattern(keyEvent.uChar.AsciiChar) && this->index < this->Limit) {
+					this->value.insert(this->value.begin() + index++, keyEvent.uChar.AsciiChar);
+					this->moveCursor(0, 1);
+					this->changed();
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// Pasang tokenizer untuk syntax highlighting, nullptr mematikannya
+		auto Highlight(std::shared_ptr<Base::Tokenizer> tokenizer) -> void {
+			this->tokenizer = std::move(tokenizer);
+			this->tokens.clear();
+			this->stale = true;
+		}
+		// Pasang penyedia saran, nullptr mematikannya
+		auto Complete(std::shared_ptr<Completion> completion) -> void {
+			this->completion = std::move(completion);
+			this->suggestions.clear();
+			this->version = 0;
+			if (this->completion) {
+				this->completion->Query(this->value);
+			}
+		}
+
+	public:
+		bool Hide = false;
+		int Limit = std::numeric_limits<int>::max();
+		std::function<bool(int)> Pattern = [](int ch) { return ch > 0x1F && ch < 0x7F; };
+
+	private:
+		// Jumlah saran yang ditampilkan di bawah area input
+		auto shown() -> int {
+			if (!this->completion || this->dismissed || this->Hide || this->value.empty() || !Focusable::Focused()) {
+				return 0;
+			}
+			return static_cast<int>(this->suggestions.size());
+		}
+		auto changed() -> void {
+			this->stale = true;
+			if (this->completion) {
+				this->dismissed = false;
+				this->completion->Query(this->value);
+			}
+		}
+		// Ganti value dengan saran terpilih dan pindahkan cursor ke akhir value
+		auto accept() -> void {
+			const std::string& text = this->completion->Candidate(this->suggestions[this->selected].Index);
+			this->value.assign(text, 0, std::min(text.size(), static_cast<size_t>(std::max(this->Limit, 0))));
+			this->stale = true;
+			this->dismissed = true;
+
+			int width = std::max(Renderable::Width, 1);
+			int line = static_cast<int>(this->value.size()) / width;
+			this->index = static_cast<int>(this->value.size());
+			this->xCursor = this->index % width;
+			this->yCursor = std::min(line, std::max(this->rows - 1, 0));
+			this->textBegin = (line - this->yCursor) * width;
+		}
+		auto moveCursor(int y, int x) -> void {
+			if (y > 0) {
+				if (this->yCursor < this->rows - 1) {
+					++this->yCursor;
+				}
+				else { this->textBegin += Renderable::Width; }
+			}
+			else if (y < 0) {
+				if (this->yCursor > 0) {
+					--this->yCursor;
+				}
+				else { this->textBegin -= Renderable::Width; }
+			}
+
+			if (x > 0) {
+				if (this->xCursor < Renderable::Width - 1) {
+					++this->xCursor;
+				}
+				else if (this->yCursor < this->rows - 1) {
+					this->xCursor = 0;
+					++this->yCursor;
+				}
+				else {
+					this->xCursor = 0;
+					this->textBegin += Renderable::Width;
+				}
+			}
+			else if (x < 0) {
+				if (this->xCursor > 0) {
+					--this->xCursor;
+				}
+				else if (this->yCursor > 0) {
+					this->xCursor = Renderable::Width - 1;
+					--this->yCursor;
+				}
+				else {
+					this->xCursor = Renderable::Width - 1;
+					this->textBegin -= Renderable::Width;
+				}
+			}
+		}
+
+	private:
+		int index = 0;
+		int yCursor = 0;
+		int xCursor = 0;
+		int textBegin = 0;
+		std::string value;
+		std::string placeholder;
+		int placeholderColumns = 0;
+		std::shared_ptr<Base::Tokenizer> tokenizer;
+		std::vector<Token> tokens;
+		bool stale = true;
+		std::shared_ptr<Completion> completion;
+		std::vector<Completion::Match> suggestions;
+		std::string answered;
+		uint64_t version = 0;
+		size_t selected = 0;
+		int rows = 0;
+		bool dismissed = false;
+	};
+	// Editor multi baris. Offset awal tiap baris disimpan terurut, sehingga baris cursor dicari dengan
+	// binary search dan pindah baris, halaman, atau lompat ke baris tertentu tidak perlu memindai text
+	class TextArea final : public Base::Renderable, public Base::Focusable {
+	public:
+		TextArea() = default;
+		TextArea(std::string value) {
+			this->Value(std::move(value));
+		}
+
+		auto Init() -> void override {
+			if (Renderable::Height == 0) {
+				Renderable::Height = 5;
+			}
+			if (Renderable::Width == 0) {
+				Renderable::Width = 30;
+			}
+		}
+		auto Set(Rectangle dimension) -> void override {
+			Renderable::Set(dimension);
+			this->follow();
+		}
+		auto Render(Buffer& buf) -> void override {
+			// Render area untuk text area
+			for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
+				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
+					buf.At(y, x).Invert = true;
+				}
+			}
+
+			int bottom = std::min(this->top + Renderable::Dimension.Bottom - Renderable::Dimension.Top, this->Lines());
+			if (this->tokenizer) {
+				this->lex(bottom);
+			}
+
+			// Hanya baris yang terlihat yang dirender, dimulai dari kolom yang tergulung ke kiri
+			for (int y = Renderable::Dimension.Top, line = this->top; line < bottom; ++y, ++line) {
+				std::string_view text = this->line(line);
+				size_t begin = skip(text, this->left);
+
+				if (!this->tokenizer) {
+					buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text.substr(begin));
+					continue;
+				}
+
+				const std::vector<Token>& tokens = this->tokens[line];
+				size_t token = 0;
+				buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text.substr(begin), [&](Pixel& pixel, size_t offset) {
+					offset += begin;
+					while (token < tokens.size() && tokens[token].End <= offset) {
+						++token;
+					}
+					if (token < tokens.size() && tokens[token].Begin <= offset) {
+						tokens[token].Apply(pixel);
+					}
+					});
+			}
+
+			// Render posisi cursor jika focus
+			if (Focusable::Focused()) {
+				buf.At(
+					Renderable::Dimension.Top + this->cursorLine - this->top,
+					Renderable::Dimension.Left + this->cursorColumn - this->left
+				).Invert = false;
+			}
+		}
+
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			int line = this->cursorLine;
+			int page = std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 1);
+			bool vertical = false;
+
+			switch (keyEvent.wVirtualKeyCode) {
+			case VK_LEFT:
+				if (this->index == 0) {
+					return false;
+				}
+				this->index = this->previous(this->index);
+				break;
+			case VK_RIGHT:
+				if (this->index == this->value.size()) {
+					return false;
+				}
+				this->index = this->next(this->index);
+				break;
+			case VK_UP:
+				if (line == 0) {
+					return false;
+				}
+				this->index = this->offset(line - 1, this->goal);
+				vertical = true;
+				break;
+			case VK_DOWN:
+				if (line == this->Lines() - 1) {
+					return false;
+				}
+				this->index = this->offset(line + 1, this->goal);
+				vertical = true;
+				break;
+			case VK_PRIOR:
+				this->index = this->offset(std::max(line - page, 0), this->goal);
+				vertical = true;
+				break;
+			case VK_NEXT:
+				this->index = this->offset(std::min(line + page, this->Lines() - 1), this->goal);
+				vertical = true;
+				break;
+			case VK_HOME:
+				this->index = this->starts[line];
+				break;
+			case VK_END:
+				this->index = this->starts[line] + this->line(line).size();
+				break;
+			case VK_RETURN:
+				this->insert("\n");
+				break;
+			case VK_BACK:
+				if (this->index == 0) {
+					return false;
+				}
+				this->erase(this->previous(this->index), this->index);
+				break;
+			case VK_DELETE:
+				if (this->index == this->value.size()) {
+					return false;
+				}
+				this->erase(this->index, this->next(this->index));
+				break;
+			case VK_TAB:
+				return false;
+			default:
+				// Surrogate UTF-16 diabaikan, hanya karakter BMP yang diterima
+				if (keyEvent.uChar.UnicodeChar < 0x20 || (keyEvent.uChar.UnicodeChar >= 0xD800 && keyEvent.uChar.UnicodeChar < 0xE000)) {
+					return false;
+				}
+
+				std::string text;
+				Unicode::Encode(keyEvent.uChar.UnicodeChar, text);
+				this->insert(text);
+			}
+
+			this->follow();
+			if (!vertical) {
+				this->goal = this->cursorColumn;
+			}
+			return true;
+		}
+
+		auto Value() -> const std::string& {
+			return this->value;
+		}
+		auto Value(std::string value) -> void {
+			this->value = std::move(value);
+			this->starts.assign(1, 0);
+			for (size_t pos = this->value.find('\n'); pos != std::string::npos; pos = this->value.find('\n', pos + 1)) {
+				this->starts.push_back(pos + 1);
+			}
+
+			this->index = 0;
+			this->goal = 0;
+			this->relex();
+			this->follow();
+		}
+		// Pasang tokenizer untuk syntax highlighting, nullptr mematikannya
+		auto Highlight(std::shared_ptr<Base::Tokenizer> tokenizer) -> void {
+			this->tokenizer = std::move(tokenizer);
+			this->relex();
+		}
+		auto GoTo(int line) -> void {
+			this->index = this->starts[std::max(std::min(line, this->Lines() - 1), 0)];
+			this->follow();
+			this->goal = this->cursorColumn;
+		}
+		auto Line() -> int {
+			return this->cursorLine;
+		}
+		auto Lines() -> int {
+			return static_cast<int>(this->starts.size());
+		}
+
+	private:
+		auto line(int line) -> std::string_view {
+			size_t end = line + 1 < this->Lines() ? this->starts[line + 1] - 1 : this->value.size();
+			return std::string_view(this->value).substr(this->starts[line], end - this->starts[line]);
+		}
+		auto lineOf(size_t offset) -> int {
+			return static_cast<int>(std::upper_bound(this->starts.begin(), this->starts.end(), offset) - this->starts.begin()) - 1;
+		}
+		// Offset byte pada baris line yang paling dekat dengan kolom column
+		auto offset(int line, int column) -> size_t {
+			std::string_view text = this->line(line);
+			size_t pos = 0;
+			for (int x = 0; pos < text.size(); ) {
+				size_t peek = pos;
+				x += Unicode::Cluster(text, peek);
+				if (x > column) {
+					break;
+				}
+				pos = peek;
+			}
+
+			return this->starts[line] + pos;
+		}
+		auto previous(size_t offset) -> size_t {
+			int line = this->lineOf(offset);
+			if (offset == this->starts[line]) {
+				return offset - 1;
+			}
+
+			std::string_view text = this->line(line);
+			size_t target = offset - this->starts[line];
+			size_t pos = 0;
+			for (size_t peek = 0; peek < target; ) {
+				pos = peek;
+				Unicode::Cluster(text, peek);
+			}
+
+			return this->starts[line] + pos;
+		}
+		auto next(size_t offset) -> size_t {
+			if (this->value[offset] == '\n') {
+				return offset + 1;
+			}
+
+			int line = this->lineOf(offset);
+			size_t pos = offset - this->starts[line];
+			Unicode::Cluster(this->line(line), pos);
+			return this->starts[line] + pos;
+		}
+		// Sisipkan text pada cursor, offset baris setelahnya digeser dan baris baru disisipkan ke index
+		auto insert(std::string_view text) -> void {
+			int line = this->lineOf(this->index);
+			for (size_t i = line + 1; i < this->starts.size(); ++i) {
+				this->starts[i] += text.size();
+			}
+
+			std::vector<size_t> added;
+			for (size_t pos = text.find('\n'); pos != std::string_view::npos; pos = text.find('\n', pos + 1)) {
+				added.push_back(this->index + pos + 1);
+			}
+			this->starts.insert(this->starts.begin() + line + 1, added.begin(), added.end());
+
+			this->value.insert(this->index, text);
+			this->index += text.size();
+
+			if (this->tokenizer) {
+				this->states.insert(this->states.begin() + line + 1, added.size(), 0);
+				this->tokens.insert(this->tokens.begin() + line + 1, added.size(), std::vector<Token>());
+				if (line < this->lexed) {
+					this->lexed += static_cast<int>(added.size());
 				}
+				this->edited(line, line + static_cast<int>(added.size()));
+			}
+		}
+		auto erase(size_t begin, size_t end) -> void {
+			int first = this->lineOf(begin);
+			int last = this->lineOf(end);
+			this->starts.erase(this->starts.begin() + first + 1, this->starts.begin() + last + 1);
+			for (size_t i = first + 1; i < this->starts.size(); ++i) {
+				this->starts[i] -= end - begin;
+			}
 
-				return false;
+			this->value.erase(begin, end - begin);
+			this->index = begin;
+
+			if (this->tokenizer) {
+				this->states.erase(this->states.begin() + first + 1, this->states.begin() + last + 1);
+				this->tokens.erase(this->tokens.begin() + first + 1, this->tokens.begin() + last + 1);
+				if (first < this->lexed) {
+					this->lexed = std::max(this->lexed - (last - first), first + 1);
+				}
+				this->edited(first, first);
+			}
+		}
+		auto relex() -> void {
+			this->lexed = 0;
+			this->states.assign(this->tokenizer ? this->Lines() : 0, 0);
+			this->tokens.assign(this->tokenizer ? this->Lines() : 0, std::vector<Token>());
+		}
+		// Lex baris yang belum pernah di-lex sampai sebelum baris until
+		auto lex(int until) -> void {
+			for (; this->lexed < until; ++this->lexed) {
+				this->tokens[this->lexed].clear();
+				int state = this->tokenizer->Tokenize(this->line(this->lexed), this->states[this->lexed], this->tokens[this->lexed]);
+				if (this->lexed + 1 < this->Lines()) {
+					this->states[this->lexed + 1] = state;
+				}
+			}
+		}
+		// Lex ulang mulai baris first. Baris first..last pasti berubah, setelahnya berhenti begitu state awal
+		// baris berikutnya sama dengan sebelumnya, karena sisa baris pasti menghasilkan token yang sama
+		auto edited(int first, int last) -> void {
+			if (first >= this->lexed) {
+				return;
 			}
 
-			if (
-				keyEvent.wVirtualKeyCode == VK_TAB ||
-				keyEvent.wVirtualKeyCode == VK_RIGHT ||
-				keyEvent.uChar.AsciiChar == 'l' ||
-				keyEvent.uChar.AsciiChar == 'L'
-				) {
-				if (this->focusedComponent < this->components.size() - 1) {
-					this->components[this->focusedComponent]->Focused(false);
-					this->components[++this->focusedComponent]->Focused(true);
-					return true;
+			for (int line = first; line < this->lexed; ++line) {
+				this->tokens[line].clear();
+				int state = this->tokenizer->Tokenize(this->line(line), this->states[line], this->tokens[line]);
+				if (line + 1 >= this->Lines()) {
+					break;
+				}
+				if (line >= last && this->states[line + 1] == state) {
+					return;
 				}
 
-				return false;
+				this->states[line + 1] = state;
+			}
+		}
+		// Geser viewport agar cursor tetap terlihat
+		auto follow() -> void {
+			this->cursorLine = this->lineOf(this->index);
+			this->cursorColumn = Unicode::Columns(std::string_view(this->value).substr(this->starts[this->cursorLine], this->index - this->starts[this->cursorLine]));
+
+			int height = Renderable::Dimension.Bottom - Renderable::Dimension.Top;
+			int width = Renderable::Dimension.Right - Renderable::Dimension.Left;
+			if (height <= 0 || width <= 0) {
+				return;
 			}
 
-			return false;
+			this->top = std::max(std::min(this->top, this->cursorLine), this->cursorLine - height + 1);
+			this->left = std::max(std::min(this->left, this->cursorColumn), this->cursorColumn - width + 1);
+		}
+		// Byte pertama yang dimulai pada atau setelah kolom columns
+		static auto skip(std::string_view text, int columns) -> size_t {
+			size_t pos = 0;
+			for (int x = 0; pos < text.size() && x < columns; ) {
+				x += Unicode::Cluster(text, pos);
+			}
+
+			return pos;
 		}
 
 	private:
-		int focusedComponent = 0;
-		std::vector<std::shared_ptr<Focusable>> components;
+		std::string value;
+		std::vector<size_t> starts = std::vector<size_t>(1, 0);
+		size_t index = 0;
+		int goal = 0;
+		int cursorLine = 0;
+		int cursorColumn = 0;
+		int top = 0;
+		int left = 0;
+		// State lexer di awal tiap baris dan token per baris, valid untuk baris sebelum lexed
+		std::shared_ptr<Base::Tokenizer> tokenizer;
+		std::vector<int> states;
+		std::vector<std::vector<Token>> tokens;
+		int lexed = 0;
 	};
-	class Button final : public Base::Renderable, public Base::Focusable {
+	// Tokenizer sederhana untuk bahasa seperti SQL atau file config: keyword (tanpa membedakan huruf besar),
+	// angka, string, komentar baris, dan komentar blok /* */ yang bisa melintasi beberapa baris
+	class KeywordTokenizer final : public Base::Tokenizer {
 	public:
-		Button(std::string name) :
-			name(std::move(name)) {
-		}
-		Button(std::string name, std::function<void()> logic) :
-			name(std::move(name)),
-			logic(std::move(logic)) {
-		}
+		enum State : int {
+			Normal,
+			BlockComment,
+			SingleQuote,
+			DoubleQuote
+		};
 
-		auto Init() -> void override {
-			Renderable::Height = 1;
-			Renderable::Width = static_cast<int>(this->name.size()) + 2;
+		KeywordTokenizer(std::vector<std::string> keywords, std::string lineComment = "--", bool blockComment = true) :
+			keywords(std::move(keywords)),
+			lineComment(std::move(lineComment)),
+			blockComment(blockComment) {
+			for (auto& keyword : this->keywords) {
+				std::transform(keyword.begin(), keyword.end(), keyword.begin(), [](unsigned char ch) { return static_cast<char>(std::tolower(ch)); });
+			}
+			std::sort(this->keywords.begin(), this->keywords.end());
 		}
-		auto Render(Buffer& buf) -> void override {
-			// Render [] kedalam buffer
-			buf.At(Renderable::Dimension.Top, Renderable::Dimension.Left).Value = "[";
-			buf.At(Renderable::Dimension.Top, Renderable::Dimension.Right - 1).Value = "]";
 
-			// Render name kedalam buffer
-			for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-				for (int x = Renderable::Dimension.Left + 1; x < Renderable::Dimension.Right - 1; ++x, ++i) {
-					buf.At(y, x).Value = this->name[i];
+		auto Tokenize(std::string_view line, int state, std::vector<Token>& tokens) -> int override {
+			size_t i = 0;
+
+			// Lanjutkan komentar atau string dari baris sebelumnya
+			if (state == BlockComment) {
+				if (!this->close(line, i, "*/", this->Comment, tokens)) {
+					return BlockComment;
+				}
+			}
+			else if (state == SingleQuote || state == DoubleQuote) {
+				if (!this->close(line, i, state == SingleQuote ? "'" : "\"", this->String, tokens)) {
+					return state;
 				}
 			}
 
-			// Jika cursor focus maka invert foreground dan background
-			if (Focusable::Focused()) {
-				for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
-						buf.At(y, x).Invert = true;
+			while (i < line.size()) {
+				unsigned char ch = static_cast<unsigned char>(line[i]);
+				size_t begin = i;
+
+				if (!this->lineComment.empty() && line.substr(i, this->lineComment.size()) == this->lineComment) {
+					push(tokens, begin, line.size(), this->Comment);
+					return Normal;
+				}
+				if (this->blockComment && line.substr(i, 2) == "/*") {
+					i += 2;
+					if (!this->close(line, i, "*/", this->Comment, tokens, begin)) {
+						return BlockComment;
+					}
+				}
+				else if (ch == '\'' || ch == '"') {
+					++i;
+					if (!this->close(line, i, ch == '\'' ? "'" : "\"", this->String, tokens, begin)) {
+						return ch == '\'' ? SingleQuote : DoubleQuote;
+					}
+				}
+				else if (std::isdigit(ch)) {
+					while (i < line.size() && (std::isalnum(static_cast<unsigned char>(line[i])) || line[i] == '.')) {
+						++i;
+					}
+					push(tokens, begin, i, this->Number);
+				}
+				else if (std::isalpha(ch) || ch == '_') {
+					std::string word;
+					while (i < line.size() && (std::isalnum(static_cast<unsigned char>(line[i])) || line[i] == '_')) {
+						word += static_cast<char>(std::tolower(static_cast<unsigned char>(line[i++])));
 					}
+					if (std::binary_search(this->keywords.begin(), this->keywords.end(), word)) {
+						push(tokens, begin, i, this->Keyword);
+					}
+				}
+				else {
+					++i;
 				}
 			}
+
+			return Normal;
 		}
 
-		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
-			switch (keyEvent.wVirtualKeyCode) {
-			case VK_RETURN:
-				if (this->logic) {
-					logic();
-					return true;
-				}
+	public:
+		Token Keyword = { 0, 0, Palette16::BrightBlue, true };
+		Token Number = { 0, 0, Palette16::BrightMagenta };
+		Token String = { 0, 0, Palette16::Green };
+		Token Comment = { 0, 0, Palette16::BrightBlack, false, true };
+
+	private:
+		// Cari penutup mulai dari i, token dimulai dari begin. Kembalikan false jika penutup tidak ada di baris ini
+		auto close(std::string_view line, size_t& i, std::string_view terminator, const Token& style, std::vector<Token>& tokens, size_t begin = 0) -> bool {
+			size_t end = line.find(terminator, i);
+			if (end == std::string_view::npos) {
+				push(tokens, begin, line.size(), style);
+				i = line.size();
+				return false;
 			}
 
-			return false;
+			i = end + terminator.size();
+			push(tokens, begin, i, style);
+			return true;
+		}
+		static auto push(std::vector<Token>& tokens, size_t begin, size_t end, const Token& style) -> void {
+			Token token = style;
+			token.Begin = static_cast<uint32_t>(begin);
+			token.End = static_cast<uint32_t>(end);
+			tokens.push_back(token);
 		}
 
 	private:
-		std::string name;
-		std::function<void()> logic;
+		std::vector<std::string> keywords;
+		std::string lineComment;
+		bool blockComment;
 	};
-	class Dropdown final : public Base::Renderable, public Base::Focusable {
-	public:
-		Dropdown(std::vector<std::string>&& values) :
-			values(std::move(values)) {
+	namespace Utility {
+		// File read-only yang dipetakan ke memori, isi file dibaca langsung tanpa salinan
+		class MappedFile final {
+		public:
+			MappedFile(const std::string& path) {
+				this->file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+				LARGE_INTEGER size;
+				if (this->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(this->file, &size)) {
+					this->error = GetLastError();
+					return;
+				}
+				if (size.QuadPart == 0) {
+					return;
+				}
+
+				// View 0 byte memetakan seluruh file
+				this->mapping = CreateFileMappingA(this->file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (this->mapping != nullptr) {
+					this->data = static_cast<const char*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+					this->size = this->data != nullptr ? static_cast<size_t>(size.QuadPart) : 0;
+				}
+				if (this->data == nullptr) {
+					this->error = GetLastError();
+				}
+			}
+			MappedFile(const MappedFile&) = delete;
+			auto operator =(const MappedFile&) -> MappedFile& = delete;
+			~MappedFile() {
+				if (this->data != nullptr) {
+					UnmapViewOfFile(this->data);
+				}
+				if (this->mapping != nullptr) {
+					CloseHandle(this->mapping);
+				}
+				if (this->file != INVALID_HANDLE_VALUE) {
+					CloseHandle(this->file);
+				}
+			}
+
+			auto Data() const -> const char* {
+				return this->data;
+			}
+			auto Size() const -> size_t {
+				return this->size;
+			}
+			// Kode GetLastError saat file gagal dibuka atau dipetakan, 0 jika berhasil (file kosong tidak dianggap gagal)
+			auto Error() const -> DWORD {
+				return this->error;
+			}
+
+		private:
+			HANDLE file = INVALID_HANDLE_VALUE;
+			HANDLE mapping = nullptr;
+			const char* data = nullptr;
+			size_t size = 0;
+			DWORD error = 0;
+		};
+
+		inline auto TrailingZeros(uint32_t mask) -> int {
+#if defined(_MSC_VER)
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return static_cast<int>(index);
+#else
+			return __builtin_ctz(mask);
+#endif
 		}
-		Dropdown(const std::vector<std::string>& values) :
-			values(values) {
+		// Panggil found(offset) untuk setiap byte ch pada [begin, end), 16 atau 32 byte dibandingkan sekaligus
+		template<class Found>
+		auto Scan(const char* data, size_t begin, size_t end, char ch, Found&& found) -> void {
+#if defined(__AVX2__)
+			__m256i needle = _mm256_set1_epi8(ch);
+			for (; begin + 32 <= end; begin += 32) {
+				__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + begin));
+				for (uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle))); mask != 0; mask &= mask - 1) {
+					found(begin + TrailingZeros(mask));
+				}
+			}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			__m128i needle = _mm_set1_epi8(ch);
+			for (; begin + 16 <= end; begin += 16) {
+				__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + begin));
+				for (uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle))); mask != 0; mask &= mask - 1) {
+					found(begin + TrailingZeros(mask));
+				}
+			}
+#endif
+			for (; begin < end; ++begin) {
+				if (data[begin] == ch) {
+					found(begin);
+				}
+			}
 		}
-		Dropdown(std::string placeholder, std::vector<std::string>&& values) :
-			placeholder(std::move(placeholder)),
-			values(std::move(values)) {
+		// Panggil found(offset) untuk setiap kemunculan needle yang dimulai pada [begin, end), needle boleh melewati end
+		// selama masih di dalam size. Byte pertama dan terakhir disaring 16 atau 32 posisi sekaligus, hanya kandidat
+		// yang lolos keduanya dibandingkan penuh
+		template<class Found>
+		auto Find(const char* data, size_t size, size_t begin, size_t end, std::string_view needle, Found&& found) -> void {
+			if (needle.empty() || needle.size() > size) {
+				return;
+			}
+
+			size_t last = needle.size() - 1;
+			size_t middle = last > 0 ? last - 1 : 0;
+			end = std::min(end, size - last);
+
+			auto check = [&](size_t offset) {
+				if (std::memcmp(data + offset + 1, needle.data() + 1, middle) == 0) {
+					found(offset);
+				}
+			};
+#if defined(__AVX2__)
+			__m256i first = _mm256_set1_epi8(needle.front());
+			__m256i final = _mm256_set1_epi8(needle.back());
+			for (; begin + 32 <= end; begin += 32) {
+				__m256i head = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + begin)), first);
+				__m256i tail = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + begin + last)), final);
+				for (uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_and_si256(head, tail))); mask != 0; mask &= mask - 1) {
+					check(begin + TrailingZeros(mask));
+				}
+			}
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			__m128i first = _mm_set1_epi8(needle.front());
+			__m128i final = _mm_set1_epi8(needle.back());
+			for (; begin + 16 <= end; begin += 16) {
+				__m128i head = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + begin)), first);
+				__m128i tail = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + begin + last)), final);
+				for (uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(head, tail))); mask != 0; mask &= mask - 1) {
+					check(begin + TrailingZeros(mask));
+				}
+			}
+#endif
+			for (; begin < end; ++begin) {
+				if (data[begin] == needle.front() && data[begin + last] == needle.back()) {
+					check(begin);
+				}
+			}
 		}
-		Dropdown(std::string placeholder, const std::vector<std::string>& values) :
-			placeholder(std::move(placeholder)),
-			values(values) {
+
+		// Pencarian substring di thread terpisah. Teks dibagi per chunk yang dicari paralel pada ThreadPool aktif,
+		// hasil setiap batch diterbitkan sesuai urutan chunk sehingga daftar match selalu terurut selama pencarian berjalan
+		class Search final {
+		public:
+			Search() = default;
+			Search(const Search&) = delete;
+			auto operator =(const Search&) -> Search& = delete;
+			~Search() {
+				this->Cancel();
+			}
+
+			// Mulai pencarian baru, pencarian sebelumnya dibatalkan. Teks harus tetap valid dan tidak berubah selama dicari
+			auto Start(const char* data, size_t size, std::string needle) -> void {
+				bool refine =
+					this->complete.load(std::memory_order_acquire) && data == this->data && size == this->size &&
+					!this->needle.empty() && needle.size() > this->needle.size() &&
+					needle.compare(0, this->needle.size(), this->needle) == 0;
+
+				this->Cancel();
+				this->data = data;
+				this->size = size;
+				this->needle = std::move(needle);
+
+				// Needle yang hanya diperpanjang cukup menyaring match dari pencarian yang sudah tuntas
+				if (refine) {
+					std::lock_guard<std::mutex> lock(this->mutex);
+					auto end = std::remove_if(this->matches.begin(), this->matches.end(), [this](size_t offset) {
+						return this->size - offset < this->needle.size() || std::memcmp(this->data + offset, this->needle.data(), this->needle.size()) != 0;
+						});
+					this->matches.erase(end, this->matches.end());
+					return;
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->matches.clear();
+				}
+				if (this->needle.empty()) {
+					return;
+				}
+
+				this->stop.store(false, std::memory_order_relaxed);
+				this->complete.store(false, std::memory_order_relaxed);
+				this->done.store(false, std::memory_order_release);
+				this->worker = std::thread([this]() { this->run(); });
+			}
+			auto Cancel() -> void {
+				this->stop.store(true, std::memory_order_relaxed);
+				if (this->worker.joinable()) {
+					this->worker.join();
+				}
+				this->done.store(true, std::memory_order_release);
+			}
+			auto Running() const -> bool {
+				return !this->done.load(std::memory_order_acquire);
+			}
+			auto Needle() const -> const std::string& {
+				return this->needle;
+			}
+			auto Count() -> size_t {
+				std::lock_guard<std::mutex> lock(this->mutex);
+				return this->matches.size();
+			}
+			// Offset match pertama yang >= offset, atau npos jika belum ditemukan
+			auto After(size_t offset) -> size_t {
+				std::lock_guard<std::mutex> lock(this->mutex);
+				auto it = std::lower_bound(this->matches.begin(), this->matches.end(), offset);
+				return it != this->matches.end() ? *it : std::string::npos;
+			}
+			// Offset match terakhir yang < offset, atau npos
+			auto Before(size_t offset) -> size_t {
+				std::lock_guard<std::mutex> lock(this->mutex);
+				auto it = std::lower_bound(this->matches.begin(), this->matches.end(), offset);
+				return it != this->matches.begin() ? *(it - 1) : std::string::npos;
+			}
+			// Salin match yang menyentuh [begin, end) ke out secara terurut
+			auto Range(size_t begin, size_t end, std::vector<size_t>& out) -> void {
+				out.clear();
+				std::lock_guard<std::mutex> lock(this->mutex);
+				size_t from = begin - std::min(begin, this->needle.size() - 1);
+				for (auto it = std::lower_bound(this->matches.begin(), this->matches.end(), from); it != this->matches.end() && *it < end; ++it) {
+					out.push_back(*it);
+				}
+			}
+
+		private:
+			auto run() -> void {
+				const size_t chunk = 1024 * 1024;
+				ThreadPool* pool = ThreadPool::Current();
+				size_t chunks = (this->size + chunk - 1) / chunk;
+				size_t batch = pool != nullptr ? static_cast<size_t>(pool->Size()) : 1;
+				std::vector<std::vector<size_t>> found(batch);
+
+				// Batch kecil agar hasil cepat terlihat dan pool tidak tertahan lama untuk render
+				for (size_t first = 0; first < chunks && !this->stop.load(std::memory_order_relaxed); first += batch) {
+					size_t count = std::min(batch, chunks - first);
+					ThreadPool::Run(static_cast<int>(count), [&](int i) {
+						size_t begin = (first + i) * chunk;
+						found[i].clear();
+						Find(this->data, this->size, begin, std::min(begin + chunk, this->size), this->needle, [&](size_t offset) {
+							found[i].push_back(offset);
+							});
+						});
+
+					{
+						std::lock_guard<std::mutex> lock(this->mutex);
+						for (size_t i = 0; i < count; ++i) {
+							this->matches.insert(this->matches.end(), found[i].begin(), found[i].end());
+						}
+					}
+					if (this->Ready) {
+						this->Ready();
+					}
+				}
+
+				this->complete.store(!this->stop.load(std::memory_order_relaxed), std::memory_order_relaxed);
+				this->done.store(true, std::memory_order_release);
+				if (this->Ready) {
+					this->Ready();
+				}
+			}
+
+		public:
+			// Dipanggil dari thread pencarian setiap batch match diterbitkan dan saat pencarian berakhir,
+			// pasang sebelum Start pertama
+			std::function<void()> Ready;
+
+		private:
+			const char* data = nullptr;
+			size_t size = 0;
+			std::string needle;
+			std::mutex mutex;
+			std::vector<size_t> matches;
+			std::atomic<bool> done{ true };
+			std::atomic<bool> complete{ false };
+			std::atomic<bool> stop{ false };
+			std::thread worker;
+		};
+	}
+
+	// Penampil file besar. File dipetakan ke memori dan index awal baris dibangun di thread terpisah,
+	// baris yang sudah terindex langsung bisa ditampilkan sebagai view ke isi file
+	class Pager final : public Base::Renderable, public Base::Focusable {
+	public:
+		Pager(const std::string& path) :
+			path(path),
+			file(path),
+			capacity(file.Size() / PageSize + 2),
+			pages(new std::unique_ptr<uint64_t[]>[capacity]),
+			wheel(TimerWheel::Current()) {
+			this->pages[0].reset(new uint64_t[PageSize]);
+			this->pages[0][0] = 0;
+			this->count.store(1, std::memory_order_relaxed);
+			this->search.Ready = [this]() { this->notify(); };
+		}
+		Pager(const Pager&) = delete;
+		auto operator =(const Pager&) -> Pager& = delete;
+		~Pager() {
+			this->search.Cancel();
+			this->stop.store(true, std::memory_order_relaxed);
+			if (this->indexer.joinable()) {
+				this->indexer.join();
+			}
 		}
 
 		auto Init() -> void override {
+			if (Renderable::Height == 0) {
+				Renderable::Height = 10;
+			}
 			if (Renderable::Width == 0) {
-				Renderable::Width = static_cast<int>(
-					std::max(
-						std::max_element(
-							this->values.begin(),
-							this->values.end(),
-							[](const std::string& a, const std::string& b) {
-								return a.size() < b.size();
-							}
-						)->size(),
-						this->placeholder.size()
-					)
-					) + 1;
+				Renderable::Width = 40;
+			}
+
+			// Index baru dibangun di sini agar Ready sempat dipasang sebelum thread indexer berjalan
+			if (!this->indexer.joinable()) {
+				this->indexer = std::thread([this]() { this->index(); });
 			}
-			Renderable::Height = Focusable::Focused() ? std::min(7, static_cast<int>(this->values.size())) : 1;
 		}
 		auto Render(Buffer& buf) -> void override {
-			// Render area untuk dropdown
-			for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
-				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
-					buf.At(y, x).Invert = true;
-				}
+			if (this->file.Error() != 0) {
+				buf.Write(Renderable::Dimension.Top, Renderable::Dimension.Left, Renderable::Dimension.Right,
+					"Tidak bisa membuka " + this->path + " (error " + std::to_string(this->file.Error()) + ")");
+				return;
 			}
 
-			if (Focusable::Focused()) {
-				// Render list values kedalam buffer
-				for (int y = Renderable::Dimension.Top, i = this->textBegin; y < Renderable::Dimension.Bottom; ++y, ++i) {
-					for (int x = Renderable::Dimension.Left + 1, ii = 0; x < Renderable::Dimension.Right; ++x, ++ii) {
-						if (ii < this->values[i].size()) {
-							buf.At(y, x).Value = this->values[i][ii];
-						}
-						else { break; }
+			size_t lines = this->Lines();
+			size_t line = this->top;
+			size_t bottom = std::min(line + std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 0), lines);
+			if (line >= bottom) {
+				return;
+			}
 
-						// Tandai index yang telah dipilih
-						if (i == this->selectedIndex) {
-							buf.At(y, Renderable::Dimension.Left).Value = "*";
-						}
-					}
+			// Hanya match pada baris yang terlihat yang diambil dari hasil pencarian
+			size_t needle = this->search.Needle().size();
+			this->search.Range(this->start(line), bottom < this->count.load(std::memory_order_acquire) ? this->start(bottom) : this->file.Size(), this->visible);
+			size_t next = 0;
+
+			for (int y = Renderable::Dimension.Top; line < bottom; ++y, ++line) {
+				std::string_view text = this->Line(line);
+
+				size_t pos = 0;
+				for (int x = 0; pos < text.size() && x < this->left; ) {
+					x += Unicode::Cluster(text, pos);
 				}
 
-				// Tandai index yang sedang focus
-				for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
-						buf.At(Renderable::Dimension.Top + this->yCursor, x).Invert = false;
+				size_t base = static_cast<size_t>(text.data() - this->file.Data()) + pos;
+				buf.Write(y, Renderable::Dimension.Left, Renderable::Dimension.Right, text.substr(pos), [&](Pixel& pixel, size_t offset) {
+					offset += base;
+					while (next < this->visible.size() && this->visible[next] + needle <= offset) {
+						++next;
 					}
-				}
+					if (next < this->visible.size() && this->visible[next] <= offset) {
+						pixel.Foreground = Palette16::Black;
+						pixel.Background = this->visible[next] == this->match ? Palette16::BrightYellow : Palette16::Yellow;
+					}
+					});
+			}
+		}
 
-				return;
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			size_t page = std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 1);
+			size_t top = this->top;
+			int left = this->left;
+
+			switch (keyEvent.wVirtualKeyCode) {
+			case VK_UP: this->Scroll(top > 0 ? top - 1 : 0); break;
+			case VK_DOWN: this->Scroll(top + 1); break;
+			case VK_PRIOR: this->Scroll(top > page ? top - page : 0); break;
+			case VK_NEXT: this->Scroll(top + page); break;
+			case VK_HOME: this->Scroll(0); break;
+			case VK_END: this->Scroll(this->Lines()); break;
+			case VK_LEFT: this->left = std::max(this->left - 8, 0); break;
+			case VK_RIGHT: this->left += 8; break;
+			case VK_F3: return (keyEvent.dwControlKeyState & SHIFT_PRESSED) ? this->Previous() : this->Next();
 			}
 
-			// Jika index belum dipilih dan placeholder diisi maka
-			// render placeholder kedalam buffer
-			if (this->selectedIndex < 0 && !this->placeholder.empty()) {
-				for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
-						if (i < this->placeholder.size()) {
-							buf.At(y, x).Italic = true;
-							buf.At(y, x).Value = this->placeholder[i];
-						}
-						else { break; }
-					}
-				}
+			return this->top != top || this->left != left;
+		}
+
+		// Jumlah baris yang sudah bisa ditampilkan, bertambah selama index masih dibangun. Index mulai dibangun
+		// pada Init pertama
+		auto Lines() const -> size_t {
+			if (this->file.Error() != 0) {
+				return 0;
 			}
-			// Jika index telah dipilih maka render index kedalam buffer
-			else {
-				for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
-						if (i < this->values[this->selectedIndex].size()) {
-							buf.At(y, x).Value = this->values[this->selectedIndex][i];
-						}
-					}
+
+			size_t count = this->count.load(std::memory_order_acquire);
+			return this->Indexing() ? count - 1 : count;
+		}
+		auto Indexing() const -> bool {
+			return !this->done.load(std::memory_order_acquire);
+		}
+		// Kode GetLastError jika file tidak bisa dibuka atau dipetakan, 0 jika berhasil
+		auto Error() const -> DWORD {
+			return this->file.Error();
+		}
+		// View ke isi file tanpa newline, valid selama Pager hidup
+		auto Line(size_t line) const -> std::string_view {
+			size_t begin = this->start(line);
+			size_t end = line + 1 < this->count.load(std::memory_order_acquire) ? this->start(line + 1) - 1 : this->file.Size();
+			if (end > begin && this->file.Data()[end - 1] == '\r') {
+				--end;
+			}
+
+			return std::string_view(this->file.Data() + begin, end - begin);
+		}
+		auto Scroll(size_t line) -> void {
+			size_t page = std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 0);
+			size_t lines = this->Lines();
+			this->top = std::min(line, lines > page ? lines - page : 0);
+		}
+		auto Top() const -> size_t {
+			return this->top;
+		}
+
+		// Mulai pencarian needle di seluruh file, bisa dipanggil setiap kali teks pencarian berubah
+		auto Find(std::string needle) -> void {
+			this->search.Start(this->file.Data(), this->file.Size(), std::move(needle));
+			this->match = std::string::npos;
+		}
+		// Jumlah match yang sudah ditemukan, bertambah selama pencarian berjalan
+		auto Matches() -> size_t {
+			return this->search.Count();
+		}
+		auto Searching() const -> bool {
+			return this->search.Running();
+		}
+		// Lompat ke match setelah match aktif atau setelah awal viewport. False jika belum ada match atau
+		// baris match belum terindex
+		auto Next() -> bool {
+			size_t from = this->match != std::string::npos ? this->match + 1 : this->start(std::min(this->top, this->Lines() - 1));
+			return this->reveal(this->search.After(from));
+		}
+		auto Previous() -> bool {
+			size_t from = this->match != std::string::npos ? this->match : this->start(std::min(this->top, this->Lines() - 1));
+			return this->reveal(this->search.Before(from));
+		}
+
+	private:
+		static constexpr size_t PageSize = 64 * 1024;
+
+		auto start(size_t line) const -> uint64_t {
+			return this->pages[line / PageSize][line % PageSize];
+		}
+		// Baris yang memuat offset, dicari biner pada index yang sudah diterbitkan
+		auto lineOf(size_t offset) const -> size_t {
+			size_t low = 0;
+			size_t high = this->count.load(std::memory_order_acquire);
+			while (high - low > 1) {
+				size_t middle = low + (high - low) / 2;
+				if (this->start(middle) <= offset) {
+					low = middle;
+				}
+				else {
+					high = middle;
 				}
 			}
+			return low;
 		}
-
-		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
-			if (
-				keyEvent.wVirtualKeyCode == VK_DOWN ||
-				keyEvent.uChar.AsciiChar == 'j' ||
-				keyEvent.uChar.AsciiChar == 'J'
-				) {
-				if (this->index < this->values.size() - 1) {
-					++this->index;
-					this->moveCursor(1);
-					return true;
-				}
-
+		// Jadikan offset match aktif dan geser viewport agar match terlihat
+		auto reveal(size_t offset) -> bool {
+			if (offset == std::string::npos) {
 				return false;
 			}
 
-			if (
-				keyEvent.wVirtualKeyCode == VK_UP ||
-				keyEvent.uChar.AsciiChar == 'k' ||
-				keyEvent.uChar.AsciiChar == 'K'
-				) {
-				if (this->index > 0) {
-					--this->index;
-					this->moveCursor(-1);
-					return true;
-				}
-
+			size_t line = this->lineOf(offset);
+			if (line >= this->Lines()) {
 				return false;
 			}
+			this->match = offset;
 
-			if (keyEvent.wVirtualKeyCode == VK_RETURN) {
-				this->selectedIndex = this->index;
-				return true;
+			size_t page = std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 1);
+			if (line < this->top || line >= this->top + page) {
+				this->Scroll(line > page / 2 ? line - page / 2 : 0);
 			}
 
-			return false;
+			int width = std::max(Renderable::Dimension.Right - Renderable::Dimension.Left, 1);
+			int column = Unicode::Columns(this->Line(line).substr(0, offset - this->start(line)));
+			if (column < this->left || column >= this->left + width) {
+				this->left = std::max(column - width / 2, 0);
+			}
+			return true;
 		}
-
-	private:
-		auto moveCursor(int y) -> void {
-			if (y > 0) {
-				if (this->yCursor < Renderable::Height - 1) {
-					++this->yCursor;
-				}
-				else { ++textBegin; }
+		// Dipanggil dari thread indexer atau pencarian setiap ada hasil baru yang perlu digambar
+		auto notify() -> void {
+			if (this->Ready) {
+				this->Ready();
 			}
-			else if (y < 0) {
-				if (this->yCursor > 0) {
-					--this->yCursor;
-				}
-				else { --textBegin; }
+			if (this->wheel != nullptr) {
+				this->wheel->Wake();
+			}
+		}
+		// Index ditulis per page tetap sehingga pembaca tidak pernah melihat realokasi, jumlah baris diterbitkan
+		// per chunk dengan release. Chunk pertama kecil agar layar pertama cepat tampil, lalu membesar sampai 4MB
+		auto index() -> void {
+			const size_t limit = 4 * 1024 * 1024;
+			size_t count = 1;
+
+			for (size_t begin = 0, chunk = 64 * 1024; begin < this->file.Size() && !this->stop.load(std::memory_order_relaxed); begin += chunk, chunk = std::min(chunk * 2, limit)) {
+				Utility::Scan(this->file.Data(), begin, std::min(begin + chunk, this->file.Size()), '\n', [&](size_t offset) {
+					if (count % PageSize == 0) {
+						this->pages[count / PageSize].reset(new uint64_t[PageSize]);
+					}
+					this->pages[count / PageSize][count % PageSize] = offset + 1;
+					++count;
+					});
+
+				this->count.store(count, std::memory_order_release);
+				this->notify();
 			}
+
+			this->done.store(true, std::memory_order_release);
+			this->notify();
 		}
 
+	public:
+		// Dipanggil dari thread indexer atau pencarian setiap ada baris atau match baru, tidak boleh menyentuh widget.
+		// Event loop juga dibangunkan lewat TimerWheel yang aktif saat Pager dibuat
+		std::function<void()> Ready;
+
 	private:
-		int index = 0;
-		int selectedIndex = -1;
-		int yCursor = 0;
-		int textBegin = 0;
-		std::string placeholder;
-		std::vector<std::string> values;
+		std::string path;
+		Utility::MappedFile file;
+		size_t capacity;
+		std::unique_ptr<std::unique_ptr<uint64_t[]>[]> pages;
+		std::atomic<size_t> count{ 0 };
+		std::atomic<bool> done{ false };
+		std::atomic<bool> stop{ false };
+		std::thread indexer;
+		TimerWheel* wheel;
+		Utility::Search search;
+		std::vector<size_t> visible;
+		size_t match = std::string::npos;
+		size_t top = 0;
+		int left = 0;
 	};
-	class Input final : public Base::Renderable, public Base::Focusable {
+	// Tree besar yang anaknya dimuat saat node dibuka. Anak sebuah node selalu bersebelahan dalam satu vector node,
+	// sedangkan baris yang terlihat disimpan datar sebagai index node. Expand dan collapse hanya menyisipkan atau
+	// menghapus rentang baris milik node tersebut, dan hanya baris di viewport yang dirender. Jumlah baris di bawah
+	// setiap node disimpan dalam Fenwick tree per kelompok anak, sehingga baris sebuah node bisa dihitung tanpa
+	// mencari di seluruh baris
+	class TreeView final : public Base::Renderable, public Base::Focusable {
 	public:
-		Input() = default;
-		Input(std::string placeholder) :
-			placeholder(std::move(placeholder)) {
+		TreeView(std::shared_ptr<Base::TreeProvider> provider, uint64_t root = 0, bool async = false) :
+			provider(std::move(provider)),
+			async(async),
+			wheel(TimerWheel::Current()) {
+			Node node;
+			node.Key = root;
+			node.Expanded = true;
+			this->nodes.push_back(std::move(node));
+			this->sums.push_back(0);
+			if (!this->async) {
+				this->load(0);
+			}
+		}
+		TreeView(const TreeView&) = delete;
+		auto operator =(const TreeView&) -> TreeView& = delete;
+		~TreeView() {
+			if (this->loader.joinable()) {
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->stopping = true;
+				}
+				this->wake.notify_one();
+				this->loader.join();
+			}
 		}
 
 		auto Init() -> void override {
 			if (Renderable::Height == 0) {
-				Renderable::Height = 1;
+				Renderable::Height = 10;
 			}
 			if (Renderable::Width == 0) {
 				Renderable::Width = 30;
 			}
+
+			// Pada mode async root baru diminta di sini agar Ready sempat dipasang, hasil loader diterapkan di thread UI
+			if (this->async && !this->loader.joinable()) {
+				this->load(0);
+			}
+			this->apply();
+		}
+		auto Set(Rectangle dimension) -> void override {
+			Renderable::Set(dimension);
+			this->follow();
 		}
 		auto Render(Buffer& buf) -> void override {
-			// Render area untuk input
-			for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
-				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
-					buf.At(y, x).Invert = true;
+			size_t bottom = std::min(this->top + std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 0), this->rows.size());
+			for (int y = Renderable::Dimension.Top; this->top + (y - Renderable::Dimension.Top) < bottom; ++y) {
+				size_t row = this->top + (y - Renderable::Dimension.Top);
+				const Node& node = this->nodes[this->rows[row]];
+
+				int x = Renderable::Dimension.Left + (node.Depth - 1) * 2;
+				if (x < Renderable::Dimension.Right) {
+					const char* marker = node.Leaf ? " " : !node.Expanded ? u8"▸" : node.Loaded ? u8"▾" : u8"…";
+					buf.Write(y, x, Renderable::Dimension.Right, marker);
+					buf.Write(y, x + 2, Renderable::Dimension.Right, node.Label);
 				}
-			}
-
-			// Render posisi cursor jika focus
-			if (Focusable::Focused()) {
-				buf.At(
-					Renderable::Dimension.Top + this->yCursor,
-					Renderable::Dimension.Left + this->xCursor
-				).Invert = false;
-			}
 
-			// Render placeholder jika terisi
-			if (this->value.empty() && !this->placeholder.empty()) {
-				for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
-						if (i < this->placeholder.size()) {
-							buf.At(y, x).Italic = true;
-							buf.At(y, x).Value = this->placeholder[i];
-						}
-						else { break; }
+				// Tandai baris cursor jika focus
+				if (row == this->cursor && Focusable::Focused()) {
+					for (int i = Renderable::Dimension.Left; i < Renderable::Dimension.Right; ++i) {
+						buf.At(y, i).Invert = true;
 					}
 				}
-
-				return;
 			}
+		}
 
-			// Render jika karakter disembunyikan, atau biasa dikenal dengan password
-			if (this->Hide) {
-				for (int y = Renderable::Dimension.Top, i = this->textBegin; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
-						if (i < this->value.size()) {
-							buf.At(y, x).Value = u8"•";
-						}
-						else { break; }
-					}
-				}
-
-				return;
+		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
+			if (this->rows.empty()) {
+				return false;
 			}
 
-			// Render karakter biasa
-			for (int y = Renderable::Dimension.Top, i = this->textBegin; y < Renderable::Dimension.Bottom; ++y) {
-				for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x, ++i) {
-					if (i < this->value.size()) {
-						buf.At(y, x).Value = this->value[i];
-					}
-					else { break; }
-				}
-			}
-		}
+			size_t page = std::max(Renderable::Dimension.Bottom - Renderable::Dimension.Top, 1);
+			size_t last = this->rows.size() - 1;
+			size_t cursor = this->cursor;
+			const Node& node = this->nodes[this->rows[cursor]];
 
-		auto OnKey(const KEY_EVENT_RECORD& keyEvent) -> bool override {
 			switch (keyEvent.wVirtualKeyCode) {
-			case VK_LEFT:
-				if (this->index > 0) {
-					--this->index;
-					this->moveCursor(0, -1);
-					return true;
-				}
-				break;
-			case VK_UP:
-				if (this->index - Renderable::Width >= 0) {
-					this->index -= Renderable::Width;
-					this->moveCursor(-1, 0);
-					return true;
-				}
-				break;
+			case VK_UP: this->Select(cursor > 0 ? cursor - 1 : 0); break;
+			case VK_DOWN: this->Select(std::min(cursor + 1, last)); break;
+			case VK_PRIOR: this->Select(cursor > page ? cursor - page : 0); break;
+			case VK_NEXT: this->Select(std::min(cursor + page, last)); break;
+			case VK_HOME: this->Select(0); break;
+			case VK_END: this->Select(last); break;
+			case VK_RETURN:
+			case VK_SPACE:
+				this->Toggle(cursor);
+				return true;
 			case VK_RIGHT:
-				if (this->index < this->value.size()) {
-					++this->index;
-					this->moveCursor(0, 1);
+				// Buka node, atau masuk ke anak pertama jika sudah terbuka
+				if (!node.Leaf && !node.Expanded) {
+					this->Expand(cursor);
 					return true;
 				}
-				break;
-			case VK_DOWN:
-				if (this->index + Renderable::Width <= this->value.size()) {
-					this->index += Renderable::Width;
-					this->moveCursor(1, 0);
-					return true;
+				if (cursor < last && this->nodes[this->rows[cursor + 1]].Parent == this->rows[cursor]) {
+					this->Select(cursor + 1);
 				}
 				break;
-			case VK_BACK:
-				if (this->index > 0) {
-					this->value.erase(this->value.begin() + --this->index);
-					this->moveCursor(0, -1);
+			case VK_LEFT:
+				// Tutup node, atau kembali ke parent jika sudah tertutup
+				if (node.Expanded) {
+					this->Collapse(cursor);
 					return true;
 				}
+				if (node.Parent != 0) {
+					this->Select(this->rowOf(node.Parent));
+				}
 				break;
-			default:
-				if (this->Pattern(keyEvent.uChar.AsciiChar) && this->index < this->Limit) {
-					this->value.insert(this->value.begin() + index++, keyEvent.uChar.AsciiChar);
-					this->moveCursor(0, 1);
-					return true;
+			}
+
+			return this->cursor != cursor;
+		}
+
+		// Jumlah baris yang terlihat jika tree digulung penuh
+		auto Rows() const -> size_t {
+			return this->rows.size();
+		}
+		auto Cursor() const -> size_t {
+			return this->cursor;
+		}
+		auto Select(size_t row) -> void {
+			this->cursor = std::min(row, this->rows.empty() ? 0 : this->rows.size() - 1);
+			this->follow();
+		}
+		auto Label(size_t row) const -> const std::string& {
+			return this->nodes[this->rows[row]].Label;
+		}
+		auto Key(size_t row) const -> uint64_t {
+			return this->nodes[this->rows[row]].Key;
+		}
+		auto Depth(size_t row) const -> int {
+			return this->nodes[this->rows[row]].Depth;
+		}
+		auto Expanded(size_t row) const -> bool {
+			return this->nodes[this->rows[row]].Expanded;
+		}
+		// Buka node pada baris row. Anak yang belum pernah dimuat diminta ke provider, pada mode async
+		// baris anak muncul setelah loader selesai
+		auto Expand(size_t row) -> void {
+			uint32_t index = this->rows[row];
+			if (this->nodes[index].Leaf || this->nodes[index].Expanded) {
+				return;
+			}
+
+			this->nodes[index].Expanded = true;
+			this->spread(index, this->nodes[index].Open);
+			if (!this->nodes[index].Loaded) {
+				if (!this->nodes[index].Pending) {
+					this->load(index);
 				}
+				return;
+			}
+			this->show(index, row + 1);
+		}
+		// Tutup node pada baris row, status buka turunannya disimpan untuk expand berikutnya
+		auto Collapse(size_t row) -> void {
+			uint32_t index = this->rows[row];
+			Node& node = this->nodes[index];
+			if (!node.Expanded) {
+				return;
 			}
+			node.Expanded = false;
 
-			return false;
+			size_t end = row + 1 + node.Open;
+			this->spread(index, -static_cast<int64_t>(node.Open));
+			this->rows.erase(this->rows.begin() + row + 1, this->rows.begin() + end);
+
+			if (this->cursor >= end) {
+				this->cursor -= end - row - 1;
+			}
+			else if (this->cursor > row) {
+				this->cursor = row;
+			}
+			this->follow();
+		}
+		auto Toggle(size_t row) -> void {
+			if (this->nodes[this->rows[row]].Expanded) {
+				this->Collapse(row);
+			}
+			else {
+				this->Expand(row);
+			}
+		}
+		// True selama masih ada node yang menunggu loader
+		auto Loading() -> bool {
+			std::lock_guard<std::mutex> lock(this->mutex);
+			return !this->requests.empty() || !this->results.empty() || this->busy;
 		}
 
 	public:
-		bool Hide = false;
-		int Limit = std::numeric_limits<int>::max();
-		std::function<bool(int)> Pattern = [](int ch) { return ch > 0x1F && ch < 0x7F; };
+		// Dipanggil dari thread loader setelah anak sebuah node selesai dimuat, pasang sebelum Init pertama. Event
+		// loop juga dibangunkan lewat TimerWheel yang aktif saat TreeView dibuat, hasilnya diterapkan pada Init
+		std::function<void()> Ready;
 
 	private:
-		auto moveCursor(int y, int x) -> void {
-			if (y > 0) {
-				if (this->yCursor < Renderable::Height - 1) {
-					++this->yCursor;
-				}
-				else { this->textBegin += Renderable::Width; }
+		class Node final {
+		public:
+			std::string Label;
+			uint64_t Key = 0;
+			uint32_t Parent = 0;
+			uint32_t First = 0;
+			uint32_t Count = 0;
+			// Jumlah baris turunan yang terlihat selama node terbuka
+			uint32_t Open = 0;
+			int Depth = 0;
+			bool Leaf = false;
+			bool Loaded = false;
+			bool Pending = false;
+			bool Expanded = false;
+		};
+		class Result final {
+		public:
+			uint32_t Node = 0;
+			std::vector<Base::TreeProvider::Item> Items;
+		};
+
+		// Muat anak node secara langsung, atau titipkan ke loader pada mode async
+		auto load(uint32_t index) -> void {
+			if (!this->async) {
+				std::vector<Base::TreeProvider::Item> items;
+				this->provider->Children(this->nodes[index].Key, items);
+				this->adopt(index, std::move(items));
+				return;
 			}
-			else if (y < 0) {
-				if (this->yCursor > 0) {
-					--this->yCursor;
+
+			this->nodes[index].Pending = true;
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->requests.push_back({ index, this->nodes[index].Key });
+			}
+			if (!this->loader.joinable()) {
+				this->loader = std::thread([this]() { this->loop(); });
+			}
+			this->wake.notify_one();
+		}
+		// Simpan anak di akhir vector node, lalu tampilkan jika node masih terbuka dan terlihat
+		auto adopt(uint32_t index, std::vector<Base::TreeProvider::Item> items) -> void {
+			this->nodes[index].First = static_cast<uint32_t>(this->nodes.size());
+			this->nodes[index].Count = static_cast<uint32_t>(items.size());
+			this->nodes[index].Loaded = true;
+			this->nodes[index].Pending = false;
+			if (items.empty()) {
+				this->nodes[index].Leaf = true;
+			}
+
+			int depth = this->nodes[index].Depth + 1;
+			for (auto& item : items) {
+				Node node;
+				node.Label = std::move(item.Label);
+				node.Key = item.Key;
+				node.Leaf = item.Leaf;
+				node.Parent = index;
+				node.Depth = depth;
+				this->nodes.push_back(std::move(node));
+			}
+
+			// Setiap anak baru berbobot satu baris, isi Fenwick untuk bobot seragam langsung dari lowbit
+			uint32_t first = this->nodes[index].First;
+			this->sums.resize(this->nodes.size());
+			for (uint32_t i = 1; i <= this->nodes[index].Count; ++i) {
+				this->sums[first + i - 1] = i & (0 - i);
+			}
+			this->nodes[index].Open = this->nodes[index].Count;
+			if (!this->nodes[index].Expanded) {
+				return;
+			}
+			this->spread(index, this->nodes[index].Count);
+
+			// Node tidak terlihat jika salah satu leluhurnya tertutup, anaknya akan tampil saat leluhur dibuka
+			size_t row = this->rowOf(index);
+			if (row != std::string::npos) {
+				this->show(index, index == 0 ? 0 : row + 1);
+			}
+		}
+		// Ubah bobot baris node pada Fenwick milik parent-nya, lalu teruskan ke leluhur selama parent terbuka.
+		// Bobot node adalah dirinya sendiri ditambah Open jika node terbuka
+		auto spread(uint32_t index, int64_t delta) -> void {
+			while (index != 0 && delta != 0) {
+				Node& parent = this->nodes[this->nodes[index].Parent];
+				for (uint32_t i = index - parent.First + 1; i <= parent.Count; i += i & (0 - i)) {
+					this->sums[parent.First + i - 1] += static_cast<uint32_t>(delta);
 				}
-				else { this->textBegin -= Renderable::Width; }
+				parent.Open += static_cast<uint32_t>(delta);
+
+				if (!parent.Expanded) {
+					return;
+				}
+				index = this->nodes[index].Parent;
 			}
+		}
+		// Baris node adalah jumlah bobot saudara sebelumnya di setiap level ditambah satu baris untuk setiap leluhur,
+		// npos jika salah satu leluhur tertutup
+		auto rowOf(uint32_t index) const -> size_t {
+			size_t row = 0;
+			while (index != 0) {
+				uint32_t parent = this->nodes[index].Parent;
+				const Node& node = this->nodes[parent];
+				if (!node.Expanded) {
+					return std::string::npos;
+				}
 
-			if (x > 0) {
-				if (this->xCursor < Renderable::Width - 1) {
-					++this->xCursor;
+				for (uint32_t i = index - node.First; i > 0; i -= i & (0 - i)) {
+					row += this->sums[node.First + i - 1];
 				}
-				else if (this->yCursor < Renderable::Height - 1) {
-					this->xCursor = 0;
-					++this->yCursor;
+				if (parent != 0) {
+					++row;
 				}
-				else {
-					this->xCursor = 0;
-					this->textBegin += Renderable::Width;
+				index = parent;
+			}
+			return row;
+		}
+		// Sisipkan baris turunan node yang terlihat pada posisi at
+		auto show(uint32_t index, size_t at) -> void {
+			std::vector<uint32_t> rows;
+			this->gather(index, rows);
+			this->rows.insert(this->rows.begin() + at, rows.begin(), rows.end());
+
+			if (this->cursor >= at && this->rows.size() > rows.size()) {
+				this->cursor += rows.size();
+			}
+			this->follow();
+		}
+		auto gather(uint32_t index, std::vector<uint32_t>& rows) const -> void {
+			for (uint32_t child = this->nodes[index].First, end = child + this->nodes[index].Count; child < end; ++child) {
+				rows.push_back(child);
+				if (this->nodes[child].Expanded && this->nodes[child].Loaded) {
+					this->gather(child, rows);
 				}
 			}
-			else if (x < 0) {
-				if (this->xCursor > 0) {
-					--this->xCursor;
+		}
+		auto apply() -> void {
+			std::vector<Result> results;
+			{
+				std::lock_guard<std::mutex> lock(this->mutex);
+				results.swap(this->results);
+			}
+
+			for (auto& result : results) {
+				this->adopt(result.Node, std::move(result.Items));
+			}
+		}
+		auto loop() -> void {
+			while (true) {
+				std::pair<uint32_t, uint64_t> request;
+				{
+					std::unique_lock<std::mutex> lock(this->mutex);
+					this->busy = false;
+					this->wake.wait(lock, [this] { return this->stopping || !this->requests.empty(); });
+					if (this->stopping) {
+						return;
+					}
+
+					request = this->requests.front();
+					this->requests.erase(this->requests.begin());
+					this->busy = true;
 				}
-				else if (this->yCursor > 0) {
-					this->xCursor = Renderable::Width - 1;
-					--this->yCursor;
+
+				Result result;
+				result.Node = request.first;
+				this->provider->Children(request.second, result.Items);
+
+				{
+					std::lock_guard<std::mutex> lock(this->mutex);
+					this->results.push_back(std::move(result));
 				}
-				else {
-					this->xCursor = Renderable::Width - 1;
-					this->textBegin -= Renderable::Width;
+				if (this->Ready) {
+					this->Ready();
+				}
+				if (this->wheel != nullptr) {
+					this->wheel->Wake();
 				}
 			}
 		}
-
-	private:
-		int index = 0;
-		int yCursor = 0;
-		int xCursor = 0;
-		int textBegin = 0;
-		std::string value;
-		std::string placeholder;
+		auto follow() -> void {
+			int height = Renderable::Dimension.Bottom - Renderable::Dimension.Top;
+			if (height <= 0) {
+				return;
+			}
+
+			this->top = std::max(std::min(this->top, this->cursor), this->cursor >= static_cast<size_t>(height) ? this->cursor - height + 1 : 0);
+		}
+
+	private:
+		std::shared_ptr<Base::TreeProvider> provider;
+		bool async;
+		TimerWheel* wheel;
+		std::vector<Node> nodes;
+		// Fenwick bobot baris anak, entri untuk anak node disimpan pada posisi yang sama dengan anak di nodes
+		std::vector<uint32_t> sums;
+		std::vector<uint32_t> rows;
+		size_t cursor = 0;
+		size_t top = 0;
+		std::thread loader;
+		std::mutex mutex;
+		std::condition_variable wake;
+		std::vector<std::pair<uint32_t, uint64_t>> requests;
+		std::vector<Result> results;
+		bool busy = false;
+		bool stopping = false;
 	};
 	class CheckBox final : public Base::Renderable, public Base::Focusable, public Base::Selectable {
 	public:
@@ -1383,7 +5615,7 @@ namespace Simple {
 
 		auto Init() -> void override {
 			Renderable::Height = 1;
-			Renderable::Width = 3 + static_cast<int>(Selectable::name.size());
+			Renderable::Width = 3 + Selectable::nameColumns;
 		}
 		auto Render(Buffer& buf) -> void override {
 			// Render [] kedalam buffer
@@ -1392,11 +5624,7 @@ namespace Simple {
 
 			// Jika nama terisi
 			if (!Selectable::name.empty()) {
-				for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left + 3; x < Renderable::Dimension.Right; ++x, ++i) {
-						buf.At(y, x).Value = Selectable::name[i];
-					}
-				}
+				buf.Write(Renderable::Dimension.Top, Renderable::Dimension.Left + 3, Renderable::Dimension.Right, Selectable::name);
 			}
 
 			// Jika cursor focus pada komponen ini
@@ -1436,7 +5664,7 @@ namespace Simple {
 
 		auto Init() -> void override {
 			Renderable::Height = 1;
-			Renderable::Width = 3 + static_cast<int>(Selectable::name.size());
+			Renderable::Width = 3 + Selectable::nameColumns;
 		}
 		auto Render(Buffer& buf) -> void override {
 			// Render [] kedalam buffer
@@ -1445,11 +5673,7 @@ namespace Simple {
 
 			// Jika nama terisi
 			if (!Selectable::name.empty()) {
-				for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-					for (int x = Renderable::Dimension.Left + 3; x < Renderable::Dimension.Right; ++x, ++i) {
-						buf.At(y, x).Value = Selectable::name[i];
-					}
-				}
+				buf.Write(Renderable::Dimension.Top, Renderable::Dimension.Left + 3, Renderable::Dimension.Right, Selectable::name);
 			}
 
 			// Jika cursor focus pada komponen ini
@@ -1489,7 +5713,7 @@ namespace Simple {
 
 		auto Init() -> void override {
 			Renderable::Height = 1;
-			Renderable::Width = (Selectable::Selected() ? 4 : 5) + static_cast<int>(Selectable::name.size());
+			Renderable::Width = (Selectable::Selected() ? 4 : 5) + Selectable::nameColumns;
 		}
 		auto Render(Buffer& buf) -> void override {
 			// Render jika on atau off
@@ -1508,11 +5732,7 @@ namespace Simple {
 			}
 
 			// Render nama kedalam buffer
-			for (int y = Renderable::Dimension.Top, i = 0; y < Renderable::Dimension.Bottom; ++y) {
-				for (int x = Renderable::Dimension.Left + (Selectable::Selected() ? 4 : 5); x < Renderable::Dimension.Right; ++x, ++i) {
-					buf.At(y, x).Value = Selectable::name[i];
-				}
-			}
+			buf.Write(Renderable::Dimension.Top, Renderable::Dimension.Left + (Selectable::Selected() ? 4 : 5), Renderable::Dimension.Right, Selectable::name);
 
 			// Jika cursor focus
 			if (Focusable::Focused()) {
@@ -1538,6 +5758,139 @@ namespace Simple {
 		}
 	};
 
+	class ProgressBar final : public Base::Renderable {
+	public:
+		ProgressBar(const std::atomic<int64_t>& value, int64_t total) :
+			value(value),
+			total(total) {
+		}
+
+		auto Init() -> void override {
+			if (Renderable::Height == 0) {
+				Renderable::Height = 1;
+			}
+			if (Renderable::Width == 0) {
+				Renderable::Width = 30;
+			}
+		}
+		auto Render(Buffer& buf) -> void override {
+			static const char* blocks[] = { " ", u8"▏", u8"▎", u8"▍", u8"▌", u8"▋", u8"▊", u8"▉", u8"█" };
+
+			int64_t current = this->value.load(std::memory_order_relaxed);
+			double fraction = this->total > 0 ? static_cast<double>(current) / static_cast<double>(this->total) : 0.0;
+			fraction = std::min(std::max(fraction, 0.0), 1.0);
+
+			// Format persentase tanpa alokasi, contoh " 42%"
+			char label[8] = { ' ' };
+			char* end = std::to_chars(label + 1, label + sizeof(label) - 1, static_cast<int>(fraction * 100)).ptr;
+			*end++ = '%';
+			int labelSize = static_cast<int>(end - label);
+
+			int barWidth = std::max(Renderable::Dimension.Right - Renderable::Dimension.Left - labelSize, 0);
+			int filled = static_cast<int>(fraction * barWidth * 8);
+
+			for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
+				for (int x = 0; x < barWidth; ++x) {
+					buf.At(y, Renderable::Dimension.Left + x).Value = blocks[std::min(std::max(filled - x * 8, 0), 8)];
+				}
+			}
+
+			// Render persentase kedalam buffer
+			for (int i = 0; i < labelSize && Renderable::Dimension.Left + barWidth + i < Renderable::Dimension.Right; ++i) {
+				buf.At(Renderable::Dimension.Top, Renderable::Dimension.Left + barWidth + i).Value = label[i];
+			}
+		}
+
+	private:
+		const std::atomic<int64_t>& value;
+		int64_t total;
+	};
+	class Gauge final : public Base::Renderable {
+	public:
+		Gauge(const std::atomic<int64_t>& value) :
+			value(value) {
+		}
+
+		auto Init() -> void override {
+			Renderable::Height = 1;
+			if (Renderable::Width == 0) {
+				Renderable::Width = 20;
+			}
+		}
+		auto Render(Buffer& buf) -> void override {
+			char text[24];
+			char* end = std::to_chars(text, text + sizeof(text), this->value.load(std::memory_order_relaxed)).ptr;
+			int size = static_cast<int>(end - text);
+
+			// Render angka rata kanan
+			int width = Renderable::Dimension.Right - Renderable::Dimension.Left;
+			for (int i = std::max(size - width, 0), x = Renderable::Dimension.Right - std::min(size, width); i < size; ++i, ++x) {
+				buf.At(Renderable::Dimension.Top, x).Value = text[i];
+			}
+		}
+
+	private:
+		const std::atomic<int64_t>& value;
+	};
+	class Sparkline final : public Base::Renderable {
+	public:
+		Sparkline(const SampleRing& samples) :
+			samples(samples) {
+			this->history.reserve(samples.Capacity());
+		}
+
+		auto Init() -> void override {
+			if (Renderable::Height == 0) {
+				Renderable::Height = 1;
+			}
+			if (Renderable::Width == 0) {
+				Renderable::Width = std::min(this->samples.Capacity(), 30);
+			}
+		}
+		auto Render(Buffer& buf) -> void override {
+			static const char* blocks[] = { " ", u8"▁", u8"▂", u8"▃", u8"▄", u8"▅", u8"▆", u8"▇", u8"█" };
+
+			this->samples.Snapshot(this->history);
+			if (this->history.empty()) {
+				return;
+			}
+
+			int width = Renderable::Dimension.Right - Renderable::Dimension.Left;
+			int height = Renderable::Dimension.Bottom - Renderable::Dimension.Top;
+			int size = static_cast<int>(this->history.size());
+			int columns = std::min(width, size);
+
+			auto range = std::minmax_element(this->history.begin(), this->history.end());
+			double low = *range.first;
+			double span = *range.second - low;
+			auto level = [&](double value) {
+				return span > 0 ? static_cast<int>((value - low) / span * (height * 8 - 1)) + 1 : height * 4;
+			};
+
+			for (int column = 0; column < columns; ++column) {
+				// Decimation min/max agar puncak tidak hilang saat sample lebih banyak dari kolom
+				int begin = column * size / columns;
+				int end = std::max((column + 1) * size / columns, begin + 1);
+				auto bucket = std::minmax_element(this->history.begin() + begin, this->history.begin() + end);
+				int bottom = level(*bucket.first);
+				int top = level(*bucket.second);
+
+				int x = Renderable::Dimension.Right - columns + column;
+				for (int row = 0; row < height; ++row) {
+					Pixel& pixel = buf.At(Renderable::Dimension.Bottom - 1 - row, x);
+					pixel.Value = blocks[std::min(std::max(top - row * 8, 0), 8)];
+
+					// Bagian antara min dan max ditampilkan redup
+					pixel.Dim = row * 8 >= bottom && top > row * 8;
+				}
+			}
+		}
+
+	private:
+		const SampleRing& samples;
+		std::vector<double> history;
+	};
+
 	class Bold final : public Base::Modifier {
 	public:
 		Bold(std::shared_ptr<Renderable> element) :
@@ -1602,21 +5955,46 @@ namespace Simple {
 			}
 		}
 	};
+	// Kedip dengan timer dari TimerWheel aktif, atau atribut blink terminal jika tidak ada wheel. Timer didaftarkan
+	// di Init yang selalu berjalan di thread event loop, Render bisa berjalan di thread pool
 	class Blink final : public Base::Modifier {
 	public:
 		Blink(std::shared_ptr<Renderable> element) :
 			Modifier(std::move(element)) {
 		}
+		~Blink() {
+			if (this->wheel != nullptr) {
+				this->wheel->Cancel(this->timer);
+			}
+		}
 
+		auto Init() -> void override {
+			Modifier::Init();
+
+			if (this->wheel == nullptr && TimerWheel::Current() != nullptr) {
+				this->wheel = TimerWheel::Current();
+				this->timer = this->wheel->Every(std::chrono::milliseconds(500), [this]() { this->visible = !this->visible; });
+			}
+		}
 		auto Render(Buffer& buf) -> void override {
 			Modifier::Render(buf);
 
 			for (int y = Modifier::Dimension.Top; y < Modifier::Dimension.Bottom; ++y) {
 				for (int x = Modifier::Dimension.Left; x < Modifier::Dimension.Right; ++x) {
-					buf.At(y, x).Blink = true;
+					if (this->wheel == nullptr) {
+						buf.At(y, x).Blink = true;
+					}
+					else if (!this->visible) {
+						buf.At(y, x).Invisible = true;
+					}
 				}
 			}
 		}
+
+	private:
+		TimerWheel* wheel = nullptr;
+		TimerWheel::Handle timer;
+		bool visible = true;
 	};
 	class Invert final : public Base::Modifier {
 	public:
@@ -1766,41 +6144,412 @@ namespace Simple {
 	};
 	class FlexX final : public Base::Modifier {
 	public:
-		FlexX(std::shared_ptr<Renderable> element) :
-			Modifier(std::move(element)) {
+		FlexX(std::shared_ptr<Renderable> element, int weight = 1) :
+			Modifier(std::move(element)),
+			weight(weight) {
 		}
 
 		auto Init() -> void override {
 			Modifier::Init();
-			Modifier::FlexX = 1;
-			Modifier::FlexY = Renderable::FlexY;
-
-			Renderable::Height = Modifier::Height;
-			Renderable::Width = Modifier::Width;
-			Renderable::FlexX = 1;
+			Renderable::Inherit(*Modifier::element);
+			Renderable::FlexX = this->weight;
 		}
+
+	private:
+		int weight;
 	};
 	class FlexY final : public Base::Modifier {
 	public:
-		FlexY(std::shared_ptr<Renderable> element) :
-			Modifier(std::move(element)) {
+		FlexY(std::shared_ptr<Renderable> element, int weight = 1) :
+			Modifier(std::move(element)),
+			weight(weight) {
+		}
+
+		auto Init() -> void override {
+			Modifier::Init();
+			Renderable::Inherit(*Modifier::element);
+			Renderable::FlexY = this->weight;
+		}
+
+	private:
+		int weight;
+	};
+	class ShrinkX final : public Base::Modifier {
+	public:
+		ShrinkX(std::shared_ptr<Renderable> element, int weight = 1) :
+			Modifier(std::move(element)),
+			weight(weight) {
+		}
+
+		auto Init() -> void override {
+			Modifier::Init();
+			Renderable::Inherit(*Modifier::element);
+			Renderable::ShrinkX = this->weight;
+		}
+
+	private:
+		int weight;
+	};
+	class ShrinkY final : public Base::Modifier {
+	public:
+		ShrinkY(std::shared_ptr<Renderable> element, int weight = 1) :
+			Modifier(std::move(element)),
+			weight(weight) {
 		}
 
 		auto Init() -> void override {
 			Modifier::Init();
-			Modifier::FlexY = 1;
-			Modifier::FlexX = Renderable::FlexX;
+			Renderable::Inherit(*Modifier::element);
+			Renderable::ShrinkY = this->weight;
+		}
+
+	private:
+		int weight;
+	};
+	// Batas ukuran minimum dan maksimum, nilai negatif berarti batas tersebut tidak diubah
+	class Bound final : public Base::Modifier {
+	public:
+		Bound(std::shared_ptr<Renderable> element, int minHeight, int maxHeight, int minWidth, int maxWidth) :
+			Modifier(std::move(element)),
+			minHeight(minHeight),
+			maxHeight(maxHeight),
+			minWidth(minWidth),
+			maxWidth(maxWidth) {
+		}
+
+		auto Init() -> void override {
+			Modifier::Init();
+			Renderable::Inherit(*Modifier::element);
+
+			if (this->minHeight >= 0) Renderable::MinHeight = this->minHeight;
+			if (this->maxHeight >= 0) Renderable::MaxHeight = this->maxHeight;
+			if (this->minWidth >= 0) Renderable::MinWidth = this->minWidth;
+			if (this->maxWidth >= 0) Renderable::MaxWidth = this->maxWidth;
+
+			Renderable::Height = Utility::Clamp(Renderable::Height, Renderable::MinHeight, Renderable::MaxHeight);
+			Renderable::Width = Utility::Clamp(Renderable::Width, Renderable::MinWidth, Renderable::MaxWidth);
+		}
+
+	private:
+		int minHeight;
+		int maxHeight;
+		int minWidth;
+		int maxWidth;
+	};
 
-			Renderable::Height = Modifier::Height;
-			Renderable::Width = Modifier::Width;
-			Renderable::FlexY = 1;
+	// Simpan hasil render subtree dan salin ulang selama layout tidak berubah
+	class Cache final : public Base::Modifier {
+	public:
+		Cache(std::shared_ptr<Renderable> element) :
+			Modifier(std::move(element)) {
+		}
+
+		auto Set(Rectangle dimension) -> void override {
+			Modifier::Set(dimension);
+			this->Invalidate();
+		}
+		auto Render(Buffer& buf) -> void override {
+			// Potong ke batas buffer, bagian diluar buffer tidak pernah terlihat
+			int top = std::max(Modifier::Dimension.Top, 0);
+			int left = std::max(Modifier::Dimension.Left, 0);
+			int bottom = std::min(Modifier::Dimension.Bottom, buf.Height());
+			int right = std::min(Modifier::Dimension.Right, buf.Width());
+			int width = right - left;
+			if (top >= bottom || width <= 0) {
+				return;
+			}
+
+			if (!this->valid) {
+				Modifier::Render(buf);
+
+				this->pixels.resize(static_cast<size_t>(bottom - top) * width);
+				for (int y = top; y < bottom; ++y) {
+					std::copy(buf.Row(y) + left, buf.Row(y) + right, this->pixels.begin() + (y - top) * width);
+				}
+				this->valid = true;
+				return;
+			}
+
+			for (int y = top; y < bottom; ++y) {
+				std::copy(this->pixels.begin() + (y - top) * width, this->pixels.begin() + (y - top + 1) * width, buf.Row(y) + left);
+			}
+		}
+		// Paksa subtree dirender ulang pada frame berikutnya, dipakai jika isinya berubah tanpa perubahan layout
+		auto Invalidate() -> void {
+			this->valid = false;
 		}
+
+	private:
+		std::vector<Pixel> pixels;
+		bool valid = false;
 	};
+
+	// Layout dengan tipe anak yang diketahui saat compile, dipanggil tanpa virtual dispatch
+	namespace Static {
+		template<class Type>
+		auto Get(Type& element) -> Type& {
+			return element;
+		}
+		template<class Type>
+		auto Get(std::shared_ptr<Type>& element) -> Type& {
+			return *element;
+		}
+
+		template<class... Elements>
+		class VerticalLayout final : public Base::Renderable {
+		public:
+			VerticalLayout(Elements... elements) :
+				elements(std::move(elements)...) {
+			}
+
+			auto Init() -> void override {
+				Renderable::Height = 0;
+				Renderable::Width = 0;
+				Renderable::FlexX = 0;
+				Renderable::FlexY = 0;
+				Renderable::ShrinkX = 0;
+				Renderable::ShrinkY = 0;
+
+				std::apply([this](auto&... element) { (this->init(Get(element)), ...); }, this->elements);
+				Renderable::Height += this->Gap * std::max(static_cast<int>(sizeof...(Elements)) - 1, 0);
+			}
+			auto Set(Rectangle dimension) -> void override {
+				Renderable::Set(dimension);
+
+				int count = static_cast<int>(sizeof...(Elements));
+				std::apply([this](auto&... element) { size_t i = 0; ((this->items[i++] = Utility::FlexItem::Column(Get(element))), ...); }, this->elements);
+				Utility::Flex(this->items.data(), count, dimension.Bottom - dimension.Top - this->Gap * std::max(count - 1, 0));
+
+				std::apply([&](auto&... element) { size_t i = 0; (this->set(Get(element), dimension, this->items[i++].Size), ...); }, this->elements);
+			}
+			auto Render(Buffer& buf) -> void override {
+				std::apply([&buf](auto&... element) { (Get(element).Render(buf), ...); }, this->elements);
+			}
+
+		private:
+			template<class Element>
+			auto init(Element& element) -> void {
+				if (element.Measure()) {
+					Renderable::Dirty = true;
+				}
+
+				Renderable::Height += Utility::Clamp(element.Height, element.MinHeight, element.MaxHeight);
+				Renderable::Width = std::max(Renderable::Width, Utility::Clamp(element.Width, element.MinWidth, element.MaxWidth));
+				Renderable::FlexX += element.FlexX;
+				Renderable::FlexY += element.FlexY;
+				Renderable::ShrinkX += element.ShrinkX;
+				Renderable::ShrinkY += element.ShrinkY;
+			}
+			template<class Element>
+			auto set(Element& element, Rectangle& dimension, int size) -> void {
+				int width = Utility::Cross(element.Width, element.MinWidth, element.MaxWidth, element.FlexX, Renderable::Dimension.Right - Renderable::Dimension.Left);
+
+				dimension.Right = dimension.Left + width;
+				dimension.Bottom = dimension.Top + size;
+				element.Place(dimension);
+
+				dimension.Top = dimension.Bottom + this->Gap;
+			}
+
+		public:
+			int Gap = 0;
+
+		private:
+			std::tuple<Elements...> elements;
+			std::array<Utility::FlexItem, sizeof...(Elements)> items;
+		};
+		template<class... Elements>
+		class HorizontalLayout final : public Base::Renderable {
+		public:
+			HorizontalLayout(Elements... elements) :
+				elements(std::move(elements)...) {
+			}
+
+			auto Init() -> void override {
+				Renderable::Height = 0;
+				Renderable::Width = 0;
+				Renderable::FlexX = 0;
+				Renderable::FlexY = 0;
+				Renderable::ShrinkX = 0;
+				Renderable::ShrinkY = 0;
+
+				std::apply([this](auto&... element) { (this->init(Get(element)), ...); }, this->elements);
+				Renderable::Width += this->Gap * std::max(static_cast<int>(sizeof...(Elements)) - 1, 0);
+			}
+			auto Set(Rectangle dimension) -> void override {
+				Renderable::Set(dimension);
+
+				int count = static_cast<int>(sizeof...(Elements));
+				std::apply([this](auto&... element) { size_t i = 0; ((this->items[i++] = Utility::FlexItem::Row(Get(element))), ...); }, this->elements);
+				Utility::Flex(this->items.data(), count, dimension.Right - dimension.Left - this->Gap * std::max(count - 1, 0));
+
+				std::apply([&](auto&... element) { size_t i = 0; (this->set(Get(element), dimension, this->items[i++].Size), ...); }, this->elements);
+			}
+			auto Render(Buffer& buf) -> void override {
+				std::apply([&buf](auto&... element) { (Get(element).Render(buf), ...); }, this->elements);
+			}
+
+		private:
+			template<class Element>
+			auto init(Element& element) -> void {
+				if (element.Measure()) {
+					Renderable::Dirty = true;
+				}
+
+				Renderable::Height = std::max(Renderable::Height, Utility::Clamp(element.Height, element.MinHeight, element.MaxHeight));
+				Renderable::Width += Utility::Clamp(element.Width, element.MinWidth, element.MaxWidth);
+				Renderable::FlexX += element.FlexX;
+				Renderable::FlexY += element.FlexY;
+				Renderable::ShrinkX += element.ShrinkX;
+				Renderable::ShrinkY += element.ShrinkY;
+			}
+			template<class Element>
+			auto set(Element& element, Rectangle& dimension, int size) -> void {
+				int height = Utility::Cross(element.Height, element.MinHeight, element.MaxHeight, element.FlexY, Renderable::Dimension.Bottom - Renderable::Dimension.Top);
+
+				dimension.Right = dimension.Left + size;
+				dimension.Bottom = dimension.Top + height;
+				element.Place(dimension);
+
+				dimension.Left = dimension.Right + this->Gap;
+			}
+
+		public:
+			int Gap = 0;
+
+		private:
+			std::tuple<Elements...> elements;
+			std::array<Utility::FlexItem, sizeof...(Elements)> items;
+		};
+
+		// Style dipakai sebagai parameter template sehingga modifier tersusun berdasarkan tipe
+		namespace Style {
+			class Paint {
+			public:
+				static constexpr bool Paints = true;
+				static auto Init(Base::Renderable&) -> void {}
+			};
+			class Bold final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Bold = true; }
+			};
+			class Dim final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Dim = true; }
+			};
+			class Italic final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Italic = true; }
+			};
+			class Underline final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Underline = true; }
+			};
+			class Blink final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Blink = true; }
+			};
+			class Invert final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Invert = true; }
+			};
+			class Invisible final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Invisible = true; }
+			};
+			class Strikethrough final : public Paint {
+			public:
+				static auto Apply(Pixel& pixel) -> void { pixel.Strikethrough = true; }
+			};
+			class FlexX final {
+			public:
+				static constexpr bool Paints = false;
+				static auto Init(Base::Renderable& element) -> void { element.FlexX = 1; }
+				static auto Apply(Pixel&) -> void {}
+			};
+			class FlexY final {
+			public:
+				static constexpr bool Paints = false;
+				static auto Init(Base::Renderable& element) -> void { element.FlexY = 1; }
+				static auto Apply(Pixel&) -> void {}
+			};
+		}
+
+		template<class Style, class Element>
+		class Modifier final : public Base::Renderable {
+		public:
+			Modifier(Element element) :
+				element(std::move(element)) {
+			}
+
+			auto Init() -> void override {
+				if (Get(this->element).Measure()) {
+					Renderable::Dirty = true;
+				}
+
+				Renderable::Height = Get(this->element).Height;
+				Renderable::Width = Get(this->element).Width;
+				Renderable::Inherit(Get(this->element));
+				Style::Init(*this);
+			}
+			auto Set(Rectangle dimension) -> void override {
+				Get(this->element).Place(dimension);
+				Renderable::Set(dimension);
+			}
+			auto Render(Buffer& buf) -> void override {
+				Get(this->element).Render(buf);
+
+				if constexpr (Style::Paints) {
+					for (int y = Renderable::Dimension.Top; y < Renderable::Dimension.Bottom; ++y) {
+						for (int x = Renderable::Dimension.Left; x < Renderable::Dimension.Right; ++x) {
+							Style::Apply(buf.At(y, x));
+						}
+					}
+				}
+			}
+
+		private:
+			Element element;
+		};
+
+		template<class Style>
+		class Tag final {};
+
+		template<class Element, class Style>
+		auto operator |(Element element, Tag<Style>) -> Modifier<Style, Element> {
+			return Modifier<Style, Element>(std::move(element));
+		}
+
+		template<class... Args>
+		auto VLayout(Args&&... elements) -> VerticalLayout<std::decay_t<Args>...> {
+			return VerticalLayout<std::decay_t<Args>...>(std::forward<Args>(elements)...);
+		}
+		template<class... Args>
+		auto HLayout(Args&&... elements) -> HorizontalLayout<std::decay_t<Args>...> {
+			return HorizontalLayout<std::decay_t<Args>...>(std::forward<Args>(elements)...);
+		}
+		// Bungkus layout statis agar bisa dipasang pada tree dinamis
+		template<class Element>
+		auto Erase(Element element) -> std::shared_ptr<Base::Renderable> {
+			return Utility::Make<Element>(std::move(element));
+		}
+
+		constexpr Tag<Style::Bold> Bold{};
+		constexpr Tag<Style::Dim> Dim{};
+		constexpr Tag<Style::Italic> Italic{};
+		constexpr Tag<Style::Underline> Underline{};
+		constexpr Tag<Style::Blink> Blink{};
+		constexpr Tag<Style::Invert> Invert{};
+		constexpr Tag<Style::Invisible> Invisible{};
+		constexpr Tag<Style::Strikethrough> Strikethrough{};
+		constexpr Tag<Style::FlexX> FlexX{};
+		constexpr Tag<Style::FlexY> FlexY{};
+	}
 }
 
 template<class... Args>
-auto SelectableGroup(Args&&... components) -> Simple::SelectableGroup {
-	return Simple::SelectableGroup(
+auto SelectableGroup(Args&&... components) -> std::shared_ptr<Simple::SelectableGroup> {
+	return Simple::Utility::Make<Simple::SelectableGroup>(
 		Simple::Utility::ToVector<std::shared_ptr<Simple::Base::Selectable>>(
 			std::forward<Args>(components)...
 		)
@@ -1808,28 +6557,40 @@ auto SelectableGroup(Args&&... components) -> Simple::SelectableGroup {
 }
 
 template<class... Args>
-auto VLayout(Args&&... elements) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::VerticalLayout>(
+auto VLayout(Args&&... elements) -> std::shared_ptr<Simple::VerticalLayout> {
+	return Simple::Utility::Make<Simple::VerticalLayout>(
 		Simple::Utility::ToVector<std::shared_ptr<Simple::Base::Renderable>>(
 			std::forward<Args>(elements)...
 		)
 	);
 }
 template<class... Args>
-auto HLayout(Args&&... elements) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::HorizontalLayout>(
+auto HLayout(Args&&... elements) -> std::shared_ptr<Simple::HorizontalLayout> {
+	return Simple::Utility::Make<Simple::HorizontalLayout>(
 		Simple::Utility::ToVector<std::shared_ptr<Simple::Base::Renderable>>(
 			std::forward<Args>(elements)...
 		)
 	);
 }
+auto Grid(std::vector<Simple::Track> columns, std::vector<Simple::Track> rows = {}) -> std::shared_ptr<Simple::Grid> {
+	return Simple::Utility::Make<Simple::Grid>(std::move(columns), std::move(rows));
+}
 auto Text(std::string value) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Text>(std::move(value));
+	return Simple::Utility::Make<Simple::Text>(std::move(value));
+}
+auto RichText(std::string_view markup) -> std::shared_ptr<Simple::Base::Renderable> {
+	return Simple::Utility::Make<Simple::RichText>(markup);
+}
+auto RichText(std::vector<Simple::RichText::Span> spans) -> std::shared_ptr<Simple::Base::Renderable> {
+	return Simple::Utility::Make<Simple::RichText>(std::move(spans));
+}
+auto Paragraph(std::string_view text) -> std::shared_ptr<Simple::Paragraph> {
+	return Simple::Utility::Make<Simple::Paragraph>(text);
 }
 
 template<class... Args>
 auto VContainer(Args&&... elements) -> std::shared_ptr<Simple::Base::Focusable> {
-	return std::make_shared<Simple::VerticalContainer>(
+	return Simple::Utility::Make<Simple::VerticalContainer>(
 		Simple::Utility::ToVector<std::shared_ptr<Simple::Base::Focusable>>(
 			std::forward<Args>(elements)...
 		)
@@ -1837,102 +6598,166 @@ auto VContainer(Args&&... elements) -> std::shared_ptr<Simple::Base::Focusable>
 }
 template<class... Args>
 auto HContainer(Args&&... elements) -> std::shared_ptr<Simple::Base::Focusable> {
-	return std::make_shared<Simple::HorizontalContainer>(
+	return Simple::Utility::Make<Simple::HorizontalContainer>(
 		Simple::Utility::ToVector<std::shared_ptr<Simple::Base::Focusable>>(
 			std::forward<Args>(elements)...
 		)
 	);
 }
 auto Button(std::string name) -> std::shared_ptr<Simple::Button> {
-	return std::make_shared<Simple::Button>(std::move(name));
+	return Simple::Utility::Make<Simple::Button>(std::move(name));
 }
 auto Button(std::string name, std::function<void()> logic) -> std::shared_ptr<Simple::Button> {
-	return std::make_shared<Simple::Button>(std::move(name), std::move(logic));
+	return Simple::Utility::Make<Simple::Button>(std::move(name), std::move(logic));
 }
 auto Dropdown(std::vector<std::string>&& values) -> std::shared_ptr<Simple::Dropdown> {
-	return std::make_shared<Simple::Dropdown>(std::move(values));
+	return Simple::Utility::Make<Simple::Dropdown>(std::move(values));
 }
 auto Dropdown(const std::vector<std::string>& values) -> std::shared_ptr<Simple::Dropdown> {
-	return std::make_shared<Simple::Dropdown>(values);
+	return Simple::Utility::Make<Simple::Dropdown>(values);
 }
 auto Dropdown(std::string placeholder, std::vector<std::string>&& values) -> std::shared_ptr<Simple::Dropdown> {
-	return std::make_shared<Simple::Dropdown>(std::move(placeholder), std::move(values));
+	return Simple::Utility::Make<Simple::Dropdown>(std::move(placeholder), std::move(values));
 }
 auto Dropdown(std::string placeholder, const std::vector<std::string>& values) -> std::shared_ptr<Simple::Dropdown> {
-	return std::make_shared<Simple::Dropdown>(std::move(placeholder), values);
+	return Simple::Utility::Make<Simple::Dropdown>(std::move(placeholder), values);
+}
+auto Completion(std::vector<std::string> candidates, size_t limit = 8) -> std::shared_ptr<Simple::Completion> {
+	return Simple::Utility::Make<Simple::Completion>(std::move(candidates), limit);
 }
 auto Input() -> std::shared_ptr<Simple::Input> {
-	return std::make_shared<Simple::Input>();
+	return Simple::Utility::Make<Simple::Input>();
 }
 auto Input(std::string placeholder) -> std::shared_ptr<Simple::Input> {
-	return std::make_shared<Simple::Input>(std::move(placeholder));
+	return Simple::Utility::Make<Simple::Input>(std::move(placeholder));
+}
+auto TextArea() -> std::shared_ptr<Simple::TextArea> {
+	return Simple::Utility::Make<Simple::TextArea>();
+}
+auto TextArea(std::string value) -> std::shared_ptr<Simple::TextArea> {
+	return Simple::Utility::Make<Simple::TextArea>(std::move(value));
+}
+auto Pager(const std::string& path) -> std::shared_ptr<Simple::Pager> {
+	return Simple::Utility::Make<Simple::Pager>(path);
+}
+auto TreeView(std::shared_ptr<Simple::Base::TreeProvider> provider, uint64_t root = 0, bool async = false) -> std::shared_ptr<Simple::TreeView> {
+	return Simple::Utility::Make<Simple::TreeView>(std::move(provider), root, async);
 }
 auto CheckBox() -> std::shared_ptr<Simple::CheckBox> {
-	return std::make_shared<Simple::CheckBox>();
+	return Simple::Utility::Make<Simple::CheckBox>();
 }
 auto CheckBox(std::string name) -> std::shared_ptr<Simple::CheckBox> {
-	return std::make_shared<Simple::CheckBox>(std::move(name));
+	return Simple::Utility::Make<Simple::CheckBox>(std::move(name));
 }
 auto RadioBox() -> std::shared_ptr<Simple::RadioBox> {
-	return std::make_shared<Simple::RadioBox>();
+	return Simple::Utility::Make<Simple::RadioBox>();
 }
 auto RadioBox(std::string name) -> std::shared_ptr<Simple::RadioBox> {
-	return std::make_shared<Simple::RadioBox>(std::move(name));
+	return Simple::Utility::Make<Simple::RadioBox>(std::move(name));
 }
 auto Toggle() -> std::shared_ptr<Simple::Toggle> {
-	return std::make_shared<Simple::Toggle>();
+	return Simple::Utility::Make<Simple::Toggle>();
 }
 auto Toggle(std::string name) -> std::shared_ptr<Simple::Toggle> {
-	return std::make_shared<Simple::Toggle>(std::move(name));
+	return Simple::Utility::Make<Simple::Toggle>(std::move(name));
+}
+
+auto ProgressBar(const std::atomic<int64_t>& value, int64_t total) -> std::shared_ptr<Simple::ProgressBar> {
+	return Simple::Utility::Make<Simple::ProgressBar>(value, total);
+}
+auto Gauge(const std::atomic<int64_t>& value) -> std::shared_ptr<Simple::Gauge> {
+	return Simple::Utility::Make<Simple::Gauge>(value);
+}
+auto Sparkline(const Simple::SampleRing& samples) -> std::shared_ptr<Simple::Sparkline> {
+	return Simple::Utility::Make<Simple::Sparkline>(samples);
 }
 
 auto Bold(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Bold>(std::move(element));
+	return Simple::Utility::Make<Simple::Bold>(std::move(element));
 }
 auto Dim(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Dim>(std::move(element));
+	return Simple::Utility::Make<Simple::Dim>(std::move(element));
 }
 auto Italic(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Italic>(std::move(element));
+	return Simple::Utility::Make<Simple::Italic>(std::move(element));
 }
 auto Underline(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Underline>(std::move(element));
+	return Simple::Utility::Make<Simple::Underline>(std::move(element));
 }
 auto Blink(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Blink>(std::move(element));
+	return Simple::Utility::Make<Simple::Blink>(std::move(element));
 }
 auto Invert(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Invert>(std::move(element));
+	return Simple::Utility::Make<Simple::Invert>(std::move(element));
 }
 auto Invisible(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Invisible>(std::move(element));
+	return Simple::Utility::Make<Simple::Invisible>(std::move(element));
 }
 auto Strikethrough(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::Strikethrough>(std::move(element));
+	return Simple::Utility::Make<Simple::Strikethrough>(std::move(element));
 }
-auto Foreground(Simple::Color color) -> std::function<std::shared_ptr<Simple::Base::Renderable>(std::shared_ptr<Simple::Base::Renderable>)> {
-	return [color](std::shared_ptr<Simple::Base::Renderable> element) {
-		return std::make_shared<Simple::Foreground>(std::move(element), color);
+auto Foreground(Simple::Color color) {
+	return [color](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::Foreground>(std::move(element), color);
 		};
 }
-auto Background(Simple::Color color) -> std::function<std::shared_ptr<Simple::Base::Renderable>(std::shared_ptr<Simple::Base::Renderable>)> {
-	return [color](std::shared_ptr<Simple::Base::Renderable> element) {
-		return std::make_shared<Simple::Background>(std::move(element), color);
+auto Background(Simple::Color color) {
+	return [color](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::Background>(std::move(element), color);
 		};
 }
 auto Border(std::shared_ptr<Simple::Base::Renderable> element) {
-	return std::make_shared<Simple::Border>(std::move(element));
+	return Simple::Utility::Make<Simple::Border>(std::move(element));
 }
-auto BorderStyle(Simple::BorderStyle style) -> std::function<std::shared_ptr<Simple::Base::Renderable>(std::shared_ptr<Simple::Base::Renderable>)> {
-	return  [style](std::shared_ptr<Simple::Base::Renderable> element) {
-		return std::make_shared<Simple::Border>(std::move(element), style);
+auto BorderStyle(Simple::BorderStyle style) {
+	return [style](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::Border>(std::move(element), style);
 		};
 }
 auto FlexY(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::FlexY>(std::move(element));
+	return Simple::Utility::Make<Simple::FlexY>(std::move(element));
 }
 auto FlexX(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
-	return std::make_shared<Simple::FlexX>(std::move(element));
+	return Simple::Utility::Make<Simple::FlexX>(std::move(element));
+}
+auto Cache(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+	return Simple::Utility::Make<Simple::Cache>(std::move(element));
+}
+auto GrowY(int weight) {
+	return [weight](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::FlexY>(std::move(element), weight);
+		};
+}
+auto GrowX(int weight) {
+	return [weight](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::FlexX>(std::move(element), weight);
+		};
+}
+auto ShrinkY(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+	return Simple::Utility::Make<Simple::ShrinkY>(std::move(element));
+}
+auto ShrinkX(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+	return Simple::Utility::Make<Simple::ShrinkX>(std::move(element));
+}
+auto MinHeight(int value) {
+	return [value](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::Bound>(std::move(element), value, -1, -1, -1);
+		};
+}
+auto MaxHeight(int value) {
+	return [value](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::Bound>(std::move(element), -1, value, -1, -1);
+		};
+}
+auto MinWidth(int value) {
+	return [value](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::Bound>(std::move(element), -1, -1, value, -1);
+		};
+}
+auto MaxWidth(int value) {
+	return [value](std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
+		return Simple::Utility::Make<Simple::Bound>(std::move(element), -1, -1, -1, value);
+		};
 }
 auto CenterY(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_ptr<Simple::Base::Renderable> {
 	return FlexY(
@@ -1953,10 +6778,11 @@ auto CenterX(std::shared_ptr<Simple::Base::Renderable> element) -> std::shared_p
 	);
 }
 
+template<class Modifier>
 auto operator |(
 	std::shared_ptr<Simple::Base::Renderable> rvalue,
-	std::function<std::shared_ptr<Simple::Base::Renderable>(std::shared_ptr<Simple::Base::Renderable>)> nvalue
-	) -> std::shared_ptr<Simple::Base::Renderable> {
+	Modifier&& nvalue
+	) -> decltype(nvalue(std::move(rvalue))) {
 	return nvalue(std::move(rvalue));
 }
 